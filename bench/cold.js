@@ -0,0 +1,105 @@
+/*
+ * Cold start benchmarks, each run in a fresh Node.js process
+ *
+ *   node bench/cold.js [-n processes] [--json results.json]
+ *
+ * Every process times the import of one build, its initialization and the
+ * first parse of a small module. The parent times the whole process,
+ * including Node.js startup, and reports the distribution of each phase.
+ */
+
+import fs from 'fs';
+import { execFileSync } from 'child_process';
+import c from 'kleur';
+
+const args = process.argv.slice(2);
+function option (name) {
+	const index = args.indexOf(name);
+	return index === -1 ? undefined : args[index + 1];
+}
+
+const n = Number(option('-n') || 20);
+const jsonPath = option('--json');
+
+const engines = [
+	{ key: 'js', name: 'JS Build', path: '../dist/lexer.asm.js', init: 'init' },
+	{ key: 'wasm', name: 'Wasm Build', path: '../dist/lexer.js', init: 'init' },
+	{ key: 'wasm-sync', name: 'Wasm Build (initSync)', path: '../dist/lexer.js', init: 'initSync' },
+	{ key: 'fast', name: 'Wasm Build (fast)', path: '../dist/lexer.fast.js', init: 'init' },
+	{ key: 'asset', name: 'Wasm Build (asset)', path: '../dist/lexer.asset.js', init: 'init' },
+	{ key: 'lexer.js', name: 'lexer.js', path: '../lexer.js', init: null }
+];
+
+const source = `import { a } from './a.js';
+import b from 'b';
+export const c = await import('./c.js');
+export { a, b };
+`;
+
+// run as the child process, where performance.now() starts at process start
+function child (url, init, source) {
+	return `
+		const startup = performance.now();
+		const m = await import(${JSON.stringify(url)});
+		const imported = performance.now();
+		${init === 'initSync' ? 'm.initSync();' : init === 'init' ? 'await m.init;' : ''}
+		const initialized = performance.now();
+		m.parse(${JSON.stringify(source)});
+		const parsed = performance.now();
+		console.log(JSON.stringify({
+			startup,
+			import: imported - startup,
+			init: initialized - imported,
+			parse: parsed - initialized
+		}));
+	`;
+}
+
+function summarize (times) {
+	const sorted = [...times].sort((a, b) => a - b);
+	const percentile = p => sorted[Math.min(Math.ceil(p * sorted.length) - 1, sorted.length - 1)];
+	return {
+		min: sorted[0],
+		p50: percentile(0.5),
+		p95: percentile(0.95),
+		max: sorted[sorted.length - 1]
+	};
+}
+
+const phases = ['startup', 'import', 'init', 'parse', 'total'];
+const results = { node: process.version, processes: n, engines: {} };
+
+for (const { key, name, path, init } of engines) {
+	const url = new URL(path, import.meta.url);
+	if (!fs.existsSync(url)) {
+		console.log(c.gray(`--- ${name}: ${path} not built ---\n`));
+		continue;
+	}
+	console.log(`--- ${name} ---`);
+
+	const script = child(url.href, init, source);
+	const times = Object.fromEntries(phases.map(phase => [phase, []]));
+	for (let i = 0; i < n; i++) {
+		const start = process.hrtime.bigint();
+		const out = execFileSync(process.execPath, ['--input-type=module', '-e', script], { stdio: ['ignore', 'pipe', 'inherit'] });
+		times.total.push(Number(process.hrtime.bigint() - start) / 1e6);
+		const run = JSON.parse(out.toString());
+		for (const phase of phases.slice(0, 4))
+			times[phase].push(run[phase]);
+	}
+
+	const engine = results.engines[key] = {};
+	for (const phase of phases) {
+		const stats = engine[phase] = summarize(times[phase]);
+		console.log(`${phase.padEnd(8)} > ${c.bold.green(stats.p50.toFixed(2) + 'ms')} p50, ` +
+			`${stats.p95.toFixed(2)}ms p95, ${stats.min.toFixed(2)}-${stats.max.toFixed(2)}ms`);
+	}
+	console.log('');
+}
+
+console.log(c.gray(`Median and 95th percentile of ${n} processes, with startup being the Node.js startup before the import and total the whole process as seen by its parent.`));
+
+if (jsonPath) {
+	fs.writeFileSync(jsonPath, JSON.stringify(results, null, 2));
+	console.log(`Results written to ${jsonPath}`);
+}
@@ -0,0 +1,135 @@
+/*
+ * Synthetic stress corpus for the benchmarks
+ *
+ *   node bench/corpus.js [--seed n] [outDir]
+ *
+ * Writes sources that exercise the slow and pathological paths of the lexer,
+ * which the library samples in test/samples rarely reach. The output only
+ * depends on the seed, so runs on different machines lex the same corpus.
+ * The directory can be passed to bench/index.js with --corpus, and its files
+ * to the native drivers.
+ */
+
+import fs from 'fs';
+import path from 'path';
+
+const args = process.argv.slice(2);
+const seedIndex = args.indexOf('--seed');
+const seed = seedIndex === -1 ? 1 : Number(args.splice(seedIndex, 2)[1]);
+const outDir = args[0] || 'lib/corpus';
+
+// the lexer's open token stack holds 1024 entries
+const MAX_DEPTH = 1000;
+
+// mulberry32
+let state = seed >>> 0;
+function random () {
+	state = state + 0x6d2b79f5 | 0;
+	let t = Math.imul(state ^ state >>> 15, 1 | state);
+	t = t + Math.imul(t ^ t >>> 7, 61 | t) ^ t;
+	return ((t ^ t >>> 14) >>> 0) / 4294967296;
+}
+function int (max) {
+	return Math.floor(random() * max);
+}
+function pick (list) {
+	return list[int(list.length)];
+}
+function repeat (count, fn) {
+	let out = '';
+	for (let i = 0; i < count; i++)
+		out += fn(i);
+	return out;
+}
+function words (count) {
+	return repeat(count, () => pick(['lorem', 'ipsum', 'dolor', 'sit', 'amet', 'import', 'export', 'from', 'class', 'yield']) + ' ');
+}
+
+const generators = {
+	// thousands of import and export statements of every form
+	'imports-exports.js': () => repeat(5000, i => pick([
+		() => `import x${i} from './m${i}.js';\n`,
+		() => `import { a${i}, b${i} as c${i} } from "pkg-${i}/sub";\n`,
+		() => `import * as ns${i} from './ns${i}.js';\n`,
+		() => `import './side-effect-${i}.js';\n`,
+		() => `import json${i} from './data${i}.json' with { type: 'json' };\n`,
+		() => `export const e${i} = ${i};\n`,
+		() => `export { x${i} as y${i}, x${i} as 'z ${i}' };\n`,
+		() => `export * from './re${i}.js';\n`,
+		() => `export * as ns${i}x from './re${i}.js';\n`,
+		() => `export function f${i} () { return import('./dyn${i}.js'); }\n`,
+		() => `export class C${i} extends Base {}\n`,
+		() => `const m${i} = import.meta.url;\n`
+	])()),
+
+	// parens, braces and template substitutions nested close to the stack limit
+	'deep-nesting.js': () => repeat(20, i => {
+		const depth = MAX_DEPTH - int(100);
+		let open = '', close = '';
+		for (let d = 0; d < depth;) {
+			const [o, c, entries] = pick([['(', ')', 1], ['{ k: ', ' }', 1], ['`${', '}`', 2]]);
+			if (d + entries > depth)
+				break;
+			open += o;
+			close = c + close;
+			d += entries;
+		}
+		return `const n${i} = ${open}a / b${close};\n`;
+	}),
+
+	// a single line of regular expressions mixed with division
+	'regex-division.min.js': () => repeat(20000, i => pick([
+		() => `a${i}=b/c/d;`,
+		() => `if(x)/re${i}[/]x/g.test(y);`,
+		() => `e=(f)/2/g;`,
+		() => `h=[/a\\/b/,1/2];`,
+		() => `function q${i}(){return/x${i}/.exec(z)}`,
+		() => `m=typeof/x/;`,
+		() => `n=a?/b/:/c/;`,
+		() => `k=l++/2/m;`,
+		() => `p=q.r/s[t]/u;`
+	])()),
+
+	// long template literals with nested substitutions
+	'templates.js': () => repeat(200, i => `const t${i} = \`${words(400 + int(400))}\${a${i}} ${
+		repeat(int(10), () => `\${\`inner ${words(20)}\${b}\`} ${words(50)}`)}\\\` \\\${notSubstituted}\`;\n`),
+
+	// huge block and line comments, including keywords the lexer must skip
+	'comments.js': () => repeat(50, i => `/*\n${repeat(500, () => ` * ${words(10)}\n`)} */\n` +
+		repeat(200, () => `// ${words(8)}import('./x.js')\n`) + `export const c${i} = ${i};\n`),
+
+	// non-ASCII identifiers, strings and specifiers
+	'unicode.js': () => repeat(5000, i => pick([
+		() => `const café${i} = 'crème brûlée';\n`,
+		() => `let π${i} = 3.14159; // π\n`,
+		() => `var 変数${i} = '値${i}';\n`,
+		() => `import { ü${i} } from './ü${i}.js';\n`,
+		() => `export { Σ${i} as 'ωμέγα${i}' };\n`,
+		() => `const emoji${i} = '😀\\u{1F600}';\n`,
+		() => `const r${i} = /[à-ÿ]+/u.test(café${i});\n`
+	])())
+};
+
+fs.mkdirSync(path.join(outDir, 'tiny'), { recursive: true });
+
+let totalSize = 0;
+let fileCount = 0;
+function write (file, source) {
+	fs.writeFileSync(path.join(outDir, file), source);
+	totalSize += Buffer.byteLength(source);
+	fileCount++;
+}
+
+for (const [file, generate] of Object.entries(generators))
+	write(file, generate());
+
+// many tiny modules, where the per-call overhead dominates
+for (let i = 0; i < 1000; i++)
+	write(`tiny/tiny-${i}.js`, repeat(1 + int(3), j => pick([
+		`import a${j} from './a${i}.js';\n`,
+		`export const b${j} = ${i};\n`,
+		`export class C${j} {}\n`,
+		`console.log(${i});\n`
+	])));
+
+console.log(`Wrote ${fileCount} files (${Math.round(totalSize / 1e3)} KiB) to ${outDir} with seed ${seed}`);
@@ -1,94 +1,307 @@
 /*
  * Shimport benchmarks for comparison
+ *
+ *   node --expose-gc bench/index.js [-n runs] [--memory] [--corpus dir] [--json results.json] [--compare baseline.json]
+ *
+ * Every parse is timed in nanoseconds. Each sample is first run until its
+ * timings settle, then timed n times, reporting percentiles, throughput and
+ * the 95% confidence interval of the mean. --json writes the results, which
+ * can be passed as the --compare baseline of a later run to flag
+ * statistically significant regressions. --memory also reports the memory
+ * each sample costs to parse.
+ *
+ * The samples are the .js files of test/samples, or of the --corpus directory,
+ * where each subdirectory is a single sample lexing all of its files.
  */
 
 import fs from 'fs';
 import c from 'kleur';
 
-const n = 100;
+const args = process.argv.slice(2);
+function option (name) {
+	const index = args.indexOf(name);
+	return index === -1 ? undefined : args[index + 1];
+}
 
-const files = fs.readdirSync('test/samples')
-	.map(f => `test/samples/${f}`)
-	.filter(x => x.endsWith('.js'))
+const n = Number(option('-n') || 100);
+const jsonPath = option('--json');
+const comparePath = option('--compare');
+const memory = args.includes('--memory');
+const corpus = option('--corpus') || 'test/samples';
+
+if (memory && !globalThis.gc)
+	throw new Error('--memory needs node --expose-gc');
+
+// warmup runs in batches until the median of a batch is within this of the
+// previous one, up to a maximum number of batches
+const WARMUP_BATCH = 10;
+const WARMUP_TOLERANCE = 0.02;
+const WARMUP_MAX_BATCHES = 50;
+// z score for a one-sided 99% confidence of a regression
+const REGRESSION_Z = 2.326;
+
+const files = fs.readdirSync(corpus)
+	.map(f => `${corpus}/${f}`)
+	.filter(x => x.endsWith('.js') || fs.statSync(x).isDirectory())
 	.map(file => {
-		const source = fs.readFileSync(file);
+		const sources = fs.statSync(file).isDirectory()
+			? fs.readdirSync(file).filter(f => f.endsWith('.js')).map(f => fs.readFileSync(`${file}/${f}`))
+			: [fs.readFileSync(file)];
 		return {
-			file,
-			code: source.toString(),
-			size: source.byteLength
+			file: sources.length === 1 ? file : `${file}/*.js`,
+			count: sources.length,
+			codes: sources.map(source => source.toString()),
+			size: sources.reduce((total, source) => total + source.byteLength, 0)
 		};
 	});
+const totalSize = files.reduce((total, { size }) => total + size, 0);
+const allFiles = `${corpus}/*.js`;
+
+function label ({ file, count, size }) {
+	return c.bold.cyan(`${file} (${count > 1 ? `${count} files, ` : ''}${Math.round(size / 1e3)} KiB)`);
+}
+
+const results = { node: process.version, runs: n, engines: {} };
+
+// keeps the parse results observable
+let sink;
+
+function ms (ns) {
+	return (ns / 1e6).toFixed(3) + 'ms';
+}
+
+function kib (bytes) {
+	return (bytes / 1024).toFixed(1) + ' KiB';
+}
+
+function median (times) {
+	const sorted = [...times].sort((a, b) => a - b);
+	return sorted[sorted.length >> 1];
+}
+
+function summarize (times, size) {
+	const sorted = [...times].sort((a, b) => a - b);
+	const mean = times.reduce((total, time) => total + time, 0) / times.length;
+	const sd = Math.sqrt(times.reduce((total, time) => total + (time - mean) ** 2, 0) / (times.length - 1));
+	const percentile = p => sorted[Math.min(Math.ceil(p * sorted.length) - 1, sorted.length - 1)];
+	return {
+		n: times.length,
+		mean,
+		sd,
+		ci95: 1.96 * sd / Math.sqrt(times.length),
+		min: sorted[0],
+		p50: percentile(0.5),
+		p95: percentile(0.95),
+		p99: percentile(0.99),
+		// bytes per nanosecond, scaled to MB/s
+		mbs: times.map(time => size / time * 1e3)
+	};
+}
+
+function report (stats, warmupRuns) {
+	const mbs = median(stats.mbs);
+	console.log(`> ${c.bold.green(ms(stats.p50))} p50, ${ms(stats.p95)} p95, ${ms(stats.p99)} p99, ` +
+		`±${(stats.ci95 / stats.mean * 100).toFixed(1)}% (95% CI), ${c.bold.green(mbs.toFixed(0) + ' MB/s')}` +
+		(warmupRuns === undefined ? '' : c.gray(` (warmed up in ${warmupRuns} runs)`)));
+}
 
 Promise.resolve().then(async () => {
-	function timeRun (code) {
+	function timeRun (codes) {
 		const start = process.hrtime.bigint();
-		const parsed = parse(code);
+		for (const code of codes)
+			sink = parse(code);
 		const end = process.hrtime.bigint();
-		return Math.round(Number(end - start) / 1e6);
+		return Number(end - start);
 	}
 
-	if (!process.env.BENCH || process.env.BENCH === 'js') {
-		console.log('--- JS Build ---');
-		console.log('Module load time');
-		{
-			const start = process.hrtime.bigint();
-			var { parse } = await import('../dist/lexer.asm.js');
-			console.log(`> ${c.bold.green(Math.round(Number(process.hrtime.bigint() - start) / 1e6) + 'ms')}`);
+	function timeAll () {
+		let total = 0;
+		for (const { codes } of files)
+			total += timeRun(codes);
+		return total;
+	}
+
+	function warmup (run) {
+		let last = Infinity;
+		for (let batch = 1; batch <= WARMUP_MAX_BATCHES; batch++) {
+			const times = [];
+			for (let i = 0; i < WARMUP_BATCH; i++)
+				times.push(run());
+			const current = median(times);
+			if (Math.abs(current - last) / last < WARMUP_TOLERANCE)
+				return batch * WARMUP_BATCH;
+			last = current;
+		}
+		return WARMUP_MAX_BATCHES * WARMUP_BATCH;
+	}
+
+	function measure (run) {
+		const times = [];
+		for (let i = 0; i < n; i++) {
+			globalThis.gc?.();
+			times.push(run());
 		}
-	
+		return times;
+	}
+
+	let lexerModule;
+	let parse;
+	let engine;
+	async function load (name, key, path) {
+		console.log(`--- ${name} ---`);
+		console.log('Module load time');
+		const start = process.hrtime.bigint();
+		const m = await import(path);
+		await m.init;
+		const loadTime = Number(process.hrtime.bigint() - start);
+		console.log(`> ${c.bold.green(ms(loadTime))}`);
+		console.log('Module size');
+		const size = fs.statSync(new URL(path, import.meta.url)).size;
+		console.log(`> ${c.bold.green(Math.round(size / 1e3) + ' KiB')}`);
+		lexerModule = m;
+		parse = m.parse;
+		engine = results.engines[key] = { load: loadTime, size, samples: {} };
+	}
+
+	if (!process.env.BENCH || process.env.BENCH === 'js') {
+		await load('JS Build', 'js', '../dist/lexer.asm.js');
 		doRun();
 	}
-	
+
 	if (!process.env.BENCH || process.env.BENCH === 'wasm') {
-		console.log('--- Wasm Build ---');
-		console.log('Module load time');
-		{
-			const start = process.hrtime.bigint();
-			var { parse, init } = await import('../dist/lexer.js');
-			await init;
-			console.log(`> ${c.bold.green(Math.round(Number(process.hrtime.bigint() - start) / 1e6) + 'ms')}`);
-		}
-	
+		await load('Wasm Build', 'wasm', '../dist/lexer.js');
+		doRun();
+	}
+
+	// -O3 / simd build exported as es-module-lexer/fast
+	if (!process.env.BENCH || process.env.BENCH === 'fast') {
+		await load('Wasm Build (fast)', 'fast', '../dist/lexer.fast.js');
+		doRun();
+	}
+
+	// lexer.wasm loaded as a separate file, exported as es-module-lexer/asset
+	if (!process.env.BENCH || process.env.BENCH === 'asset') {
+		await load('Wasm Build (asset)', 'asset', '../dist/lexer.asset.js');
 		doRun();
 	}
 
 	function doRun () {
 		console.log('Cold Run, All Samples');
-		let totalSize = 0;
-		{
-			let total = 0;
-			files.forEach(({ code, size }) => {
-				totalSize += size;
-				total += timeRun(code);
+		engine.cold = timeAll();
+		console.log(c.bold.cyan(`${allFiles} (${Math.round(totalSize / 1e3)} KiB)`));
+		console.log(`> ${c.bold.green(ms(engine.cold))}`);
+		globalThis.gc?.();
+
+		console.log(`\nWarm Runs (${n} runs)`);
+		for (const sample of files) {
+			const { file, codes, size } = sample;
+			console.log(label(sample));
+			const warmupRuns = warmup(() => timeRun(codes));
+			const stats = engine.samples[file] = summarize(measure(() => timeRun(codes)), size);
+			report(stats, warmupRuns);
+		}
+
+		console.log(`\nWarm Runs, All Samples (${n} runs)`);
+		console.log(c.bold.cyan(`${allFiles} (${Math.round(totalSize / 1e3)} KiB)`));
+		const stats = engine.samples[allFiles] = summarize(measure(timeAll), totalSize);
+		report(stats);
+		console.log('');
+
+		if (memory)
+			measureMemory();
+	}
+
+	// The Wasm builds parse with a fresh Lexer per sample, so that the instance
+	// memory reflects that sample alone. The heap delta includes the garbage
+	// of the parse, while the retained size is what is left after a gc with
+	// the results still referenced.
+	function measureMemory () {
+		const { Lexer } = lexerModule;
+		const samples = engine.memory = {};
+
+		function measure (files, lexer) {
+			const lexerParse = lexer ? code => lexer.parse(code) : parse;
+			let analysis = null;
+			sink = undefined;
+			globalThis.gc();
+			const before = process.memoryUsage().heapUsed;
+			const results = files.flatMap(({ codes }) => codes).map(code => {
+				const result = lexerParse(code);
+				if (lexer)
+					analysis = Math.max(analysis, lexer.analysisBytes);
+				return result;
 			});
-			console.log(c.bold.cyan(`test/samples/*.js (${Math.round(totalSize / 1e3)} KiB)`));
-			console.log(`> ${c.bold.green(total + 'ms')}`);
-			gc();
+			const heapDelta = process.memoryUsage().heapUsed - before;
+			globalThis.gc();
+			const retained = process.memoryUsage().heapUsed - before;
+			sink = results;
+			return {
+				wasmMemory: lexer ? lexer.highWaterMark : null,
+				analysis,
+				heapDelta,
+				retained
+			};
 		}
-	
-		console.log(`\nWarm Runs (average of ${n} runs)`);
-		files.forEach(({ file, code, size }) => {
-			console.log(c.bold.cyan(`${file} (${Math.round(size / 1e3)} KiB)`));
-	
-			let total = 0;
-			for (let i = 0; i < n; i++) {
-				total += timeRun(code);
-				gc();
+
+		function report ({ wasmMemory, analysis, heapDelta, retained }) {
+			console.log(`> ${wasmMemory === null ? '' : `${c.bold.green(kib(wasmMemory))} wasm memory, ${kib(analysis)} analysis, `}` +
+				`${kib(heapDelta)} heap delta, ${c.bold.green(kib(retained))} retained`);
+		}
+
+		console.log('Memory');
+		for (const file of files) {
+			console.log(label(file));
+			report(samples[file.file] = measure([file], Lexer && new Lexer()));
+		}
+		console.log(c.bold.cyan(`${allFiles} (${Math.round(totalSize / 1e3)} KiB), all results retained`));
+		report(samples[allFiles] = measure(files, Lexer && new Lexer()));
+		sink = undefined;
+		console.log('');
+	}
+
+	if (jsonPath) {
+		fs.writeFileSync(jsonPath, JSON.stringify(results, null, 2));
+		console.log(`Results written to ${jsonPath}`);
+	}
+
+	if (comparePath)
+		compare(JSON.parse(fs.readFileSync(comparePath, 'utf8')));
+});
+
+// Welch's test on the sample means, where a slowdown is a regression when
+// its z score exceeds the one-sided 99% bound
+function compare (baseline) {
+	console.log(`--- Comparison with ${comparePath} ---`);
+	let regressions = 0;
+	for (const [key, engine] of Object.entries(results.engines)) {
+		const baseEngine = baseline.engines[key];
+		if (!baseEngine) {
+			console.log(c.gray(`${key}: not in the baseline`));
+			continue;
+		}
+		for (const [file, stats] of Object.entries(engine.samples)) {
+			const base = baseEngine.samples[file];
+			if (!base)
+				continue;
+			const change = (stats.mean - base.mean) / base.mean;
+			const z = (stats.mean - base.mean) / Math.sqrt(stats.sd ** 2 / stats.n + base.sd ** 2 / base.n);
+			const delta = `${change > 0 ? '+' : ''}${(change * 100).toFixed(1)}%`;
+			let verdict;
+			if (z > REGRESSION_Z) {
+				regressions++;
+				verdict = c.bold.red(`${delta} regression`);
 			}
-	
-			console.log(`> ${c.bold.green((total / n) + 'ms')}`);
-		});
-	
-		console.log(`\nWarm Runs, All Samples (average of ${n} runs)`);
-		{
-			let total = 0;
-			for (let i = 0; i < n; i++) {
-				files.forEach(({ code }) => {
-					total += timeRun(code);
-				});
+			else if (z < -REGRESSION_Z) {
+				verdict = c.bold.green(`${delta} improvement`);
 			}
-			console.log(c.bold.cyan(`test/samples/*.js (${Math.round(totalSize / 1e3)} KiB)`));
-			console.log(`> ${c.bold.green((total / n) + 'ms')}`);
+			else {
+				verdict = c.gray(`${delta} not significant`);
+			}
+			console.log(`${key} ${file}: ${ms(base.mean)} -> ${ms(stats.mean)} ${verdict} (z = ${z.toFixed(2)})`);
 		}
 	}
-});
+	if (regressions) {
+		console.log(c.bold.red(`${regressions} significant regression${regressions === 1 ? '' : 's'}`));
+		process.exitCode = 1;
+	}
+}
@@ -0,0 +1,169 @@
+/*
+ * Cross-engine benchmark matrix
+ *
+ *   node bench/matrix.js [-n runs] [--corpus dir]
+ *
+ * Lexes the same samples with every engine that has been built: the Wasm
+ * builds, the asm.js build, lexer.js, the MoonBit port and the native C
+ * driver. The results of each engine are checked against the first one, and
+ * the throughput of every engine is reported side by side.
+ *
+ * As with bench/index.js, the samples are the .js files of test/samples or of
+ * the --corpus directory, with each subdirectory a single sample.
+ */
+
+import fs from 'fs';
+import { execFileSync } from 'child_process';
+import { fileURLToPath } from 'url';
+import c from 'kleur';
+import { fromSpecifiers, difference } from './results.js';
+
+const args = process.argv.slice(2);
+function option (name) {
+	const index = args.indexOf(name);
+	return index === -1 ? undefined : args[index + 1];
+}
+
+const n = Number(option('-n') || 20);
+const corpus = option('--corpus') || 'test/samples';
+
+const nativeBin = fileURLToPath(new URL('../lib/pgo/lexer-native', import.meta.url));
+
+const samples = fs.readdirSync(corpus)
+	.map(f => `${corpus}/${f}`)
+	.filter(x => x.endsWith('.js') || fs.statSync(x).isDirectory())
+	.map(file => {
+		const paths = fs.statSync(file).isDirectory()
+			? fs.readdirSync(file).filter(f => f.endsWith('.js')).map(f => `${file}/${f}`)
+			: [file];
+		const sources = paths.map(path => fs.readFileSync(path));
+		return {
+			file: paths.length === 1 ? file : `${file}/*.js`,
+			paths,
+			codes: sources.map(source => source.toString()),
+			size: sources.reduce((total, source) => total + source.byteLength, 0)
+		};
+	});
+
+// see lexer-moon/src/js/js.mbt for the layout
+function fromMoonBit (out) {
+	if (out[0] === -1)
+		return { error: out[1] };
+	const [importCount, exportCount, facade, hasModuleSyntax] = out;
+	const imports = [], exports = [];
+	for (let i = 0, offset = 4; i < importCount; i++, offset += 7)
+		imports.push(out.slice(offset, offset + 7));
+	for (let i = 0, offset = 4 + importCount * 7; i < exportCount; i++, offset += 4)
+		exports.push(out.slice(offset, offset + 4));
+	return { imports, exports, facade: !!facade, hasModuleSyntax: !!hasModuleSyntax };
+}
+
+// the parse of each engine is timed as it is, its results are only normalized
+// for the comparison
+const jsEngines = [
+	{ name: 'wasm', path: '../dist/lexer.js', load: m => m.parse, normalize: fromSpecifiers },
+	{ name: 'fast', path: '../dist/lexer.fast.js', load: m => m.parse, normalize: fromSpecifiers },
+	{ name: 'asm.js', path: '../dist/lexer.asm.js', load: m => m.parse, normalize: fromSpecifiers },
+	{ name: 'lexer.js', path: '../lexer.js', load: m => m.parse, normalize: fromSpecifiers },
+	{ name: 'moonbit', path: '../lexer-moon/target/js/release/build/js/js.js', load: m => m.parse_source, normalize: fromMoonBit }
+];
+
+function best (run) {
+	let best = Infinity;
+	for (let i = 0; i < n; i++) {
+		const start = process.hrtime.bigint();
+		run();
+		const time = Number(process.hrtime.bigint() - start);
+		if (time < best)
+			best = time;
+	}
+	return best;
+}
+
+const engines = [];
+
+for (const { name, path, load, normalize } of jsEngines) {
+	const url = new URL(path, import.meta.url);
+	if (!fs.existsSync(url)) {
+		console.log(c.gray(`${name}: ${path} not built, skipping`));
+		continue;
+	}
+	const m = await import(url);
+	await m.init;
+	const parse = load(m);
+	engines.push({
+		name,
+		results: sample => sample.codes.map(code => {
+			try {
+				return normalize(parse(code));
+			}
+			catch (err) {
+				return { error: err.idx ?? -1 };
+			}
+		}),
+		time: sample => {
+			// warmup
+			for (let i = 0; i < 5; i++)
+				sample.codes.forEach(code => parse(code));
+			return best(() => sample.codes.forEach(code => parse(code)));
+		}
+	});
+}
+
+if (fs.existsSync(nativeBin)) {
+	engines.push({
+		name: 'native',
+		results: sample => execFileSync(nativeBin, ['-d', ...sample.paths], { maxBuffer: 1 << 28 }).toString().trim().split('\n')
+			.map(line => JSON.parse(line)),
+		time: sample => {
+			const out = execFileSync(nativeBin, ['-n', String(n), ...sample.paths]).toString();
+			return Number(out.match(/: ([\d.]+)ms/)[1]) * 1e6;
+		}
+	});
+}
+else {
+	console.log(c.gray('native: lib/pgo/lexer-native not built, skipping'));
+}
+
+if (!engines.length)
+	throw new Error('No engines have been built');
+
+const width = Math.max(...samples.map(({ file }) => file.length), 12) + 2;
+console.log(`\nMB/s, best of ${n} runs, checked against ${engines[0].name}\n`);
+console.log(''.padEnd(width) + engines.map(({ name }) => name.padStart(12)).join(''));
+
+const differences = [];
+const totals = engines.map(() => 0);
+for (const sample of samples) {
+	const reference = engines[0].results(sample);
+	let row = sample.file.padEnd(width);
+	engines.forEach((engine, index) => {
+		const results = index === 0 ? reference : engine.results(sample);
+		let differs = false;
+		results.forEach((result, i) => {
+			const diff = difference(result, reference[i]);
+			if (diff) {
+				differs = true;
+				differences.push(`${engine.name} ${sample.paths[i]}: ${diff}`);
+			}
+		});
+		const time = engine.time(sample);
+		totals[index] += time;
+		const cell = (sample.size / time * 1e3).toFixed(0) + (differs ? ' ✗' : '  ');
+		row += differs ? c.red(cell.padStart(12)) : cell.padStart(12);
+	});
+	console.log(row);
+}
+
+const totalSize = samples.reduce((total, { size }) => total + size, 0);
+console.log(c.bold('total'.padEnd(width) + totals.map(time => (totalSize / time * 1e3).toFixed(0).padStart(10) + '  ').join('')));
+
+if (differences.length) {
+	console.log(c.bold.red(`\n${differences.length === 1 ? '1 result differs' : `${differences.length} results differ`} from ${engines[0].name}:`));
+	for (const diff of differences)
+		console.log(`  ${diff}`);
+	process.exitCode = 1;
+}
+else {
+	console.log(c.bold.green('\nAll engines agree'));
+}
@@ -0,0 +1,295 @@
+/*
+ * Micro-benchmarks for the individual scanner routines of the lexer
+ *
+ *   micro [-n reps] [--json] [file.js...]
+ *
+ * Each routine is run in isolation over a generated input of its token kind,
+ * and the full parse over a generated module plus every given file. Every
+ * repetition is timed separately, so that the variance between repetitions
+ * is reported alongside the throughput. With --json the results are written
+ * as JSON to stdout for comparing runs.
+ */
+
+#include "native.h"
+#include <math.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+// the TSC ticks at a constant reference rate, which can differ from the
+// core clock under frequency scaling
+#define CYCLE_COUNTER "tsc"
+static inline uint64_t cycles () {
+  return __rdtsc();
+}
+#else
+#define CYCLE_COUNTER NULL
+static inline uint64_t cycles () {
+  return 0;
+}
+#endif
+
+// code units of each generated input
+#define GENERATED_LEN (1 << 16)
+// minimum duration of a single repetition, routines are looped to reach it
+#define REP_MS 2.0
+
+typedef struct {
+  const char* name;
+  char16_t* input;
+  size_t len;
+  // runs the routine once over the input, returning false if it did not end
+  // where expected
+  bool (*run) (char16_t* input, size_t len);
+} Case;
+
+typedef struct {
+  double mean;
+  double stddev;
+  double min;
+  double median;
+  double max;
+} Stats;
+
+typedef struct {
+  const Case* c;
+  size_t iterations;
+  Stats mbs;
+  Stats cyclesPerUnit;
+} Result;
+
+OpenToken benchTokenStack[1024];
+
+// points the lexer at the input, with pos on its first code unit
+void setInput (char16_t* input, size_t len) {
+  setSource(input);
+  sourceLen = len;
+  pos = input;
+  end = input + len - 1;
+  has_error = false;
+  openTokenStack = benchTokenStack;
+  openTokenDepth = 0;
+}
+
+bool runStringLiteral (char16_t* input, size_t len) {
+  setInput(input, len);
+  stringLiteral(*pos);
+  return !has_error && pos == end;
+}
+
+bool runTemplateString (char16_t* input, size_t len) {
+  setInput(input, len);
+  openTokenStack[openTokenDepth++].token = Template;
+  templateString();
+  return !has_error && pos == end;
+}
+
+bool runBlockComment (char16_t* input, size_t len) {
+  setInput(input, len);
+  blockComment(true);
+  return pos == end;
+}
+
+bool runRegularExpression (char16_t* input, size_t len) {
+  setInput(input, len);
+  regularExpression();
+  return !has_error && pos == end;
+}
+
+bool runCommentWhitespace (char16_t* input, size_t len) {
+  setInput(input, len);
+  return commentWhitespace(true) == 'x' && pos == end;
+}
+
+// the input is a space separated list of words, each checked from its last code unit
+bool runIsExpressionKeyword (char16_t* input, size_t len) {
+  setInput(input, len);
+  size_t keywords = 0;
+  for (char16_t* wordEnd = input; wordEnd < input + len; wordEnd++) {
+    if (*(wordEnd + 1) == ' ' && isExpressionKeyword(wordEnd))
+      keywords++;
+  }
+  return keywords > 0;
+}
+
+bool runParse (char16_t* input, size_t len) {
+  setSource(input);
+  sa(len);
+  return parse();
+}
+
+// repeats whole patterns to about len code units between the prefix and suffix,
+// with room after the source for the analysis of a parse
+Case generate (const char* name, const char* prefix, const char* pattern, const char* suffix, bool (*run) (char16_t*, size_t)) {
+  size_t prefixLen = strlen(prefix);
+  size_t patternLen = strlen(pattern);
+  size_t suffixLen = strlen(suffix);
+  size_t repeats = (GENERATED_LEN - prefixLen - suffixLen) / patternLen;
+  size_t len = prefixLen + repeats * patternLen + suffixLen;
+  char16_t* input = malloc((len + 1) * 2 + (len + 1) * 64);
+  size_t i = 0;
+  for (size_t p = 0; p < prefixLen; p++)
+    input[i++] = prefix[p];
+  for (size_t r = 0; r < repeats; r++) {
+    for (size_t p = 0; p < patternLen; p++)
+      input[i++] = pattern[p];
+  }
+  for (size_t p = 0; p < suffixLen; p++)
+    input[i++] = suffix[p];
+  input[len] = '\0';
+  return (Case){ name, input, len, run };
+}
+
+Stats stats (double* samples, size_t n) {
+  Stats s = { 0, 0, samples[0], 0, samples[0] };
+  for (size_t i = 0; i < n; i++) {
+    s.mean += samples[i];
+    if (samples[i] < s.min)
+      s.min = samples[i];
+    if (samples[i] > s.max)
+      s.max = samples[i];
+  }
+  s.mean /= n;
+  for (size_t i = 0; i < n; i++)
+    s.stddev += (samples[i] - s.mean) * (samples[i] - s.mean);
+  s.stddev = n > 1 ? sqrt(s.stddev / (n - 1)) : 0;
+  // insertion sort, the sample counts are small
+  for (size_t i = 1; i < n; i++) {
+    double sample = samples[i];
+    size_t j = i;
+    for (; j > 0 && samples[j - 1] > sample; j--)
+      samples[j] = samples[j - 1];
+    samples[j] = sample;
+  }
+  s.median = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+  return s;
+}
+
+bool bench (const Case* c, int reps, Result* result) {
+  if (!c->run(c->input, c->len))
+    return false;
+
+  // calibrate the iterations per repetition from a warm run
+  double start = now();
+  c->run(c->input, c->len);
+  double once = now() - start;
+  size_t iterations = once > 0 ? (size_t)ceil(REP_MS / once) : 1000;
+
+  double* mbs = malloc(reps * sizeof(double));
+  double* cyclesPerUnit = malloc(reps * sizeof(double));
+  for (int rep = 0; rep < reps; rep++) {
+    start = now();
+    uint64_t startCycles = cycles();
+    for (size_t i = 0; i < iterations; i++)
+      c->run(c->input, c->len);
+    uint64_t repCycles = cycles() - startCycles;
+    double time = now() - start;
+    double units = (double)c->len * iterations;
+    mbs[rep] = units * 2 / time / 1e3;
+    cyclesPerUnit[rep] = repCycles / units;
+  }
+  result->c = c;
+  result->iterations = iterations;
+  result->mbs = stats(mbs, reps);
+  result->cyclesPerUnit = stats(cyclesPerUnit, reps);
+  free(mbs);
+  free(cyclesPerUnit);
+  return true;
+}
+
+void printStats (const char* name, Stats s, bool comma) {
+  printf("      \"%s\": { \"mean\": %.4f, \"stddev\": %.4f, \"min\": %.4f, \"median\": %.4f, \"max\": %.4f }%s\n",
+      name, s.mean, s.stddev, s.min, s.median, s.max, comma ? "," : "");
+}
+
+void printJson (Result* results, size_t resultCount, int reps) {
+  printf("{\n  \"reps\": %d,\n", reps);
+  if (CYCLE_COUNTER)
+    printf("  \"cycleCounter\": \"%s\",\n", CYCLE_COUNTER);
+  else
+    printf("  \"cycleCounter\": null,\n");
+  printf("  \"results\": [\n");
+  for (size_t i = 0; i < resultCount; i++) {
+    Result* r = &results[i];
+    printf("    {\n      \"name\": \"");
+    for (const char* ch = r->c->name; *ch; ch++) {
+      if (*ch == '"' || *ch == '\\')
+        putchar('\\');
+      putchar(*ch);
+    }
+    printf("\",\n      \"units\": %zu,\n      \"iterations\": %zu,\n", r->c->len, r->iterations);
+    printStats("mbs", r->mbs, CYCLE_COUNTER != NULL);
+    if (CYCLE_COUNTER)
+      printStats("cyclesPerUnit", r->cyclesPerUnit, false);
+    printf("    }%s\n", i + 1 < resultCount ? "," : "");
+  }
+  printf("  ]\n}\n");
+}
+
+void printTable (Result* results, size_t resultCount, int reps) {
+  printf("%-40s %10s %8s %10s\n", "", "MB/s", "+/-", "cycles/cu");
+  for (size_t i = 0; i < resultCount; i++) {
+    Result* r = &results[i];
+    printf("%-40s %10.1f %7.1f%%", r->c->name, r->mbs.median, r->mbs.stddev / r->mbs.mean * 100);
+    if (CYCLE_COUNTER)
+      printf(" %10.2f", r->cyclesPerUnit.median);
+    printf("\n");
+  }
+  printf("median of %d repetitions, +/- is the coefficient of variation\n", reps);
+}
+
+int main (int argc, char** argv) {
+  int reps = 20;
+  bool json = false;
+  int argi = 1;
+  for (; argi < argc; argi++) {
+    if (strcmp(argv[argi], "-n") == 0 && argi + 1 < argc)
+      reps = atoi(argv[++argi]);
+    else if (strcmp(argv[argi], "--json") == 0)
+      json = true;
+    else
+      break;
+  }
+  if (reps < 1)
+    reps = 1;
+
+  size_t fileCount = argc - argi;
+  Case* cases = malloc((7 + fileCount) * sizeof(Case));
+  size_t caseCount = 0;
+  cases[caseCount++] = generate("stringLiteral", "'", "some string \\' content ", "'", runStringLiteral);
+  cases[caseCount++] = generate("templateString", "`", "template $ {} \\` text\n", "`", runTemplateString);
+  cases[caseCount++] = generate("blockComment", "/*", " * comment line\n", "*/", runBlockComment);
+  cases[caseCount++] = generate("regularExpression", "/", "[a-z/\\]]+\\/(?:x|y)\\d*", "/", runRegularExpression);
+  cases[caseCount++] = generate("commentWhitespace", "", "  \n\t// line comment\n/* block */\r\n", "x", runCommentWhitespace);
+  cases[caseCount++] = generate("isExpressionKeyword", "", "return typeof x case foo void instanceof await delete bar else in yield new ", "", runIsExpressionKeyword);
+  cases[caseCount++] = generate("parse (generated)", "", "import { a as b } from './dep.js';\nexport const c = x / 2 + `t${b}`;\nif (a) /re[/]/.test(c);\n", "", runParse);
+
+  for (size_t i = 0; i < fileCount; i++) {
+    SourceFile file;
+    if (!readSourceFile(argv[argi + i], &file)) {
+      fprintf(stderr, "Unable to read %s\n", argv[argi + i]);
+      return 1;
+    }
+    const char* base = strrchr(file.name, '/');
+    char* name = malloc(strlen(file.name) + 7);
+    sprintf(name, "parse %s", base ? base + 1 : file.name);
+    // the analysis arena follows the source, and is bounded by the source length
+    char16_t* input = malloc((file.len + 1) * 2 + (file.len + 1) * 64);
+    memcpy(input, file.source, file.len * 2);
+    free(file.source);
+    cases[caseCount++] = (Case){ name, input, file.len, runParse };
+  }
+
+  Result* results = malloc(caseCount * sizeof(Result));
+  for (size_t i = 0; i < caseCount; i++) {
+    if (!bench(&cases[i], reps, &results[i])) {
+      fprintf(stderr, "%s did not lex its input as expected\n", cases[i].name);
+      return 1;
+    }
+  }
+
+  if (json)
+    printJson(results, caseCount, reps);
+  else
+    printTable(results, caseCount, reps);
+  return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * Native driver for the lexer, used to train and compare PGO builds
+ *
+ *   native [-n runs] [-d] [-j chunks] file.js...
+ *
+ * Lexes every file once per run and reports the best run. With -d, every file
+ * is instead lexed once and its results are written as a line of JSON, for
+ * comparing against the other engines.
+ *
+ * Built with -DLEXER_THREADS -pthread, -j lexes each file in up to that many
+ * chunks on as many threads, see src/parallel.c.
+ *
+ * Built with -DLEXER_TRACE, every file fires the USDT probes described in
+ * src/lexer.h, with the file name as the source name.
+ */
+
+#include "native.h"
+
+uint32_t chunks = 0;
+
+bool parseFile () {
+#ifdef LEXER_THREADS
+  if (chunks)
+    return pp(chunks);
+#endif
+  return parse();
+}
+
+// imports as [s, e, ss, se, d, a, t] and exports as [s, e, ls, le], as in parseRaw
+void dumpResults (const char* name) {
+  printf("{\"file\":\"%s\",", name);
+  if (!parseFile()) {
+    TRACE(done);
+    printf("\"error\":%u}\n", e());
+    return;
+  }
+  TRACE(extract);
+  printf("\"imports\":[");
+  while (ri())
+    printf("%s[%d,%d,%d,%d,%d,%d,%d]", import_read_head == first_import ? "" : ",", (int32_t)is(), (int32_t)ie(), (int32_t)ss(), (int32_t)se(), (int32_t)id(), (int32_t)ai(), (int32_t)it());
+  printf("],\"exports\":[");
+  while (re())
+    printf("%s[%d,%d,%d,%d]", export_read_head == first_export ? "" : ",", (int32_t)es(), (int32_t)ee(), els(), ele());
+  printf("],\"facade\":%s,\"hasModuleSyntax\":%s}\n", f() ? "true" : "false", ms() ? "true" : "false");
+  TRACE(done);
+}
+
+int main (int argc, char** argv) {
+  int runs = 1;
+  bool dump = false;
+  int argi = 1;
+  for (; argi < argc; argi++) {
+    if (strcmp(argv[argi], "-n") == 0 && argi + 1 < argc)
+      runs = atoi(argv[++argi]);
+    else if (strcmp(argv[argi], "-d") == 0)
+      dump = true;
+    else if (strcmp(argv[argi], "-j") == 0 && argi + 1 < argc)
+      chunks = atoi(argv[++argi]);
+    else
+      break;
+  }
+
+#ifndef LEXER_THREADS
+  if (chunks) {
+    fprintf(stderr, "-j needs a build with -DLEXER_THREADS\n");
+    return 1;
+  }
+#endif
+
+  size_t fileCount = argc - argi;
+  SourceFile* files = malloc(fileCount * sizeof(SourceFile));
+  size_t maxLen = 0;
+  size_t totalLen = 0;
+  for (size_t i = 0; i < fileCount; i++) {
+    if (!readSourceFile(argv[argi + i], &files[i])) {
+      fprintf(stderr, "Unable to read %s\n", argv[argi + i]);
+      return 1;
+    }
+    if (files[i].len > maxLen)
+      maxLen = files[i].len;
+    totalLen += files[i].len;
+  }
+
+  // source followed by the analysis arena, which is bounded by the source length
+  char16_t* memory = malloc((maxLen + 1) * 2 + (maxLen + 1) * 64);
+
+  if (dump) {
+    for (size_t i = 0; i < fileCount; i++) {
+      loadSource(memory, &files[i]);
+      dumpResults(files[i].name);
+    }
+    return 0;
+  }
+
+  double best = 0;
+  size_t errors = 0;
+  for (int run = 0; run < runs; run++) {
+    errors = 0;
+    double start = now();
+    for (size_t i = 0; i < fileCount; i++) {
+      loadSource(memory, &files[i]);
+      if (!parseFile())
+        errors++;
+      TRACE(done);
+    }
+    double time = now() - start;
+    if (run == 0 || time < best)
+      best = time;
+  }
+
+  printf("%zu files (%zu KiB), best of %d: %.3fms (%.1f MB/s)", fileCount, totalLen * 2 / 1024, runs, best, totalLen * 2 / best / 1e3);
+  if (errors)
+    printf(", %zu with errors", errors);
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * The lexer built natively, with the source loading and timing shared by the
+ * native benchmark drivers
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdlib.h>
+#include <time.h>
+
+// the wasm build places the source at the heap base, natively it is set per file
+unsigned char __heap_base;
+
+#ifdef LEXER_THREADS
+#include "../src/parallel.c"
+#else
+#include "../src/lexer.c"
+#endif
+
+typedef struct {
+  const char* name;
+  char16_t* source;
+  size_t len;
+} SourceFile;
+
+// UTF-8 to UTF-16, invalid sequences are passed through byte by byte
+size_t decodeUtf8 (const unsigned char* in, size_t inLen, char16_t* out) {
+  size_t len = 0;
+  size_t i = 0;
+  while (i < inLen) {
+    uint32_t c = in[i];
+    if (c >= 0xf0 && i + 3 < inLen) {
+      c = (c & 0x07) << 18 | (in[i + 1] & 0x3f) << 12 | (in[i + 2] & 0x3f) << 6 | (in[i + 3] & 0x3f);
+      i += 4;
+    }
+    else if (c >= 0xe0 && i + 2 < inLen) {
+      c = (c & 0x0f) << 12 | (in[i + 1] & 0x3f) << 6 | (in[i + 2] & 0x3f);
+      i += 3;
+    }
+    else if (c >= 0xc0 && i + 1 < inLen) {
+      c = (c & 0x1f) << 6 | (in[i + 1] & 0x3f);
+      i += 2;
+    }
+    else {
+      i++;
+    }
+    if (c >= 0x10000) {
+      c -= 0x10000;
+      out[len++] = 0xd800 | c >> 10;
+      out[len++] = 0xdc00 | (c & 0x3ff);
+    }
+    else {
+      out[len++] = c;
+    }
+  }
+  return len;
+}
+
+bool readSourceFile (const char* name, SourceFile* file) {
+  FILE* fp = fopen(name, "rb");
+  if (fp == NULL)
+    return false;
+  fseek(fp, 0, SEEK_END);
+  size_t size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  unsigned char* bytes = malloc(size + 1);
+  size_t read = fread(bytes, 1, size, fp);
+  fclose(fp);
+  file->name = name;
+  file->source = malloc((read + 1) * 2);
+  file->len = decodeUtf8(bytes, read, file->source);
+  free(bytes);
+  return true;
+}
+
+// copies a file in as the source to lex
+void loadSource (char16_t* memory, SourceFile* file) {
+#ifdef LEXER_TRACE
+  traceName = file->name;
+#endif
+  setSource(memory);
+  sa(file->len);
+  TRACE(copy);
+  memcpy(memory, file->source, file->len * 2);
+}
+
+double now () {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
@@ -0,0 +1,36 @@
+/*
+ * Normalized parse results, for comparing engines
+ *
+ * Results are compared as imports [s, e, ss, se, d, a, t], exports [s, e, ls, le],
+ * facade and hasModuleSyntax, or as { error } when the source failed to lex.
+ * Fields an engine does not report are left undefined and skipped in the
+ * comparison.
+ */
+
+export function fromSpecifiers ([imports, exports, facade, hasModuleSyntax]) {
+	return {
+		imports: imports.map(({ s, e, ss, se, d, a, t }) => [s, e, ss, se, d, a, t]),
+		exports: exports.map(({ s, e, ls, le }) => [s, e, ls, le]),
+		facade,
+		hasModuleSyntax
+	};
+}
+
+// the first difference between two results, or undefined if they agree
+export function difference (result, reference) {
+	if (result.error !== undefined || reference.error !== undefined)
+		return result.error === reference.error ? undefined : `error ${result.error} vs ${reference.error}`;
+	for (const kind of ['imports', 'exports']) {
+		if (result[kind].length !== reference[kind].length)
+			return `${result[kind].length} ${kind} vs ${reference[kind].length}`;
+		for (let i = 0; i < result[kind].length; i++) {
+			const a = result[kind][i], b = reference[kind][i];
+			if (a.some((value, j) => value !== undefined && b[j] !== undefined && value !== b[j]))
+				return `${kind}[${i}] ${JSON.stringify(a)} vs ${JSON.stringify(b)}`;
+		}
+	}
+	for (const flag of ['facade', 'hasModuleSyntax']) {
+		if (result[flag] !== undefined && reference[flag] !== undefined && result[flag] !== reference[flag])
+			return `${flag} ${result[flag]} vs ${reference[flag]}`;
+	}
+}
@@ -14,31 +14,13 @@ const copy = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1 ? function (sr
   }
 };
 
-const words = 'xportmportlassforetaourceeferromsyncunctionssertvoyiedelecontininstantybreareturdebuggeawaithrwhileifcatcfinallels';
-
 let source, name;
-export function parse (_source, _name = '@') {
-  source = _source;
-  name = _name;
-  // 2 bytes per string code point
-  // + analysis space (2^17)
-  // remaining space is EMCC stack space (2^17)
-  const memBound = source.length * 2 + (2 << 18);
-  if (memBound > allocSize || !asm) {
-    while (memBound > allocSize) allocSize *= 2;
-    asmBuffer = new ArrayBuffer(allocSize);
-    copy(words, new Uint16Array(asmBuffer, 16, words.length));
-    asm = asmInit(typeof self !== 'undefined' ? self : global, {}, asmBuffer);
-    // lexer.c bulk allocates string space + analysis space
-    addr = asm.su(allocSize - (2<<17));
-  }
-  const len = source.length + 1;
-  asm.ses(addr);
-  asm.sa(len - 1);
-
-  copy(source, new Uint16Array(asmBuffer, addr, len));
+export function parse (_source, _name = '@', budget = 0) {
+  copySource(_source, _name);
+  if (budget > 0)
+    asm.sb(budget);
 
-  if (!asm.p()) {
+  if (!asm.p() && !asm.bx()) {
     acornPos = asm.e();
     syntaxError();
   }
@@ -62,7 +44,47 @@ export function parse (_source, _name = '@') {
     });
   }
 
-  return [imports, exports, !!asm.f(), !!asm.ms()];
+  return [imports, exports, !!asm.f(), !!asm.ms(), !!asm.bx()];
+}
+
+export function detectModuleSyntax (_source, _name = '@') {
+  copySource(_source, _name);
+
+  if (!asm.md()) {
+    acornPos = asm.e();
+    syntaxError();
+  }
+
+  return !!asm.ms();
+}
+
+export function resetMemory (threshold = 0) {
+  if (!asm || allocSize <= threshold)
+    return false;
+  asm = asmBuffer = undefined;
+  allocSize = 2<<19;
+  return true;
+}
+
+function copySource (_source, _name) {
+  source = _source;
+  name = _name;
+  // 2 bytes per string code point
+  // + analysis space (2^17)
+  // remaining space is EMCC stack space (2^17)
+  const memBound = source.length * 2 + (2 << 18);
+  if (memBound > allocSize || !asm) {
+    while (memBound > allocSize) allocSize *= 2;
+    asmBuffer = new ArrayBuffer(allocSize);
+    asm = asmInit(typeof self !== 'undefined' ? self : global, {}, asmBuffer);
+    // lexer.c bulk allocates string space + analysis space
+    addr = asm.su(allocSize - (2<<17));
+  }
+  const len = source.length + 1;
+  asm.ses(addr);
+  asm.sa(len - 1);
+
+  copy(source, new Uint16Array(asmBuffer, addr, len));
 }
 
 /*
@@ -214,11 +236,144 @@ function syntaxError () {
 }
 
 // function asmInit () { ... } from lib/lexer.asm.js is concatenated at the end here
-function asmInit(global,env,buffer) {
-"use asm";var a=new global.Int8Array(buffer),b=new global.Int16Array(buffer),c=new global.Int32Array(buffer),d=new global.Uint8Array(buffer),e=new global.Uint16Array(buffer),v=1040;function z(){var d=0,e=0,f=0,g=0,h=0,i=0,j=0;j=v;v=v+10240|0;a[812]=1;a[811]=0;b[403]=0;b[404]=0;c[71]=c[2];a[813]=0;c[70]=0;a[810]=0;c[72]=j+2048;c[73]=j;a[814]=0;d=(c[3]|0)+-2|0;c[74]=d;e=d+(c[68]<<1)|0;c[75]=e;a:while(1){f=d+2|0;c[74]=f;if(d>>>0>=e>>>0){g=18;break}b:do switch(b[f>>1]|0){case 9:case 10:case 11:case 12:case 13:case 32:break;case 101:{if((((b[404]|0)==0?fa(f)|0:0)?(Q(d+4|0,16,10)|0)==0:0)?(B(),(a[812]|0)==0):0){g=9;break a}else g=17;break}case 105:{if(fa(f)|0?(Q(d+4|0,26,10)|0)==0:0){C();g=17}else g=17;break}case 59:{g=17;break}case 47:switch(b[d+4>>1]|0){case 47:{$();break b}case 42:{P(1);break b}default:{g=16;break a}}default:{g=16;break a}}while(0);if((g|0)==17){g=0;c[71]=c[74]}d=c[74]|0;e=c[75]|0}if((g|0)==9){d=c[74]|0;c[71]=d;g=19}else if((g|0)==16){a[812]=0;c[74]=d;g=19}else if((g|0)==18)if(!(a[810]|0)){d=f;g=19}else d=0;do if((g|0)==19){c:while(1){e=d+2|0;c[74]=e;if(d>>>0>=(c[75]|0)>>>0){g=92;break}d:do switch(b[e>>1]|0){case 9:case 10:case 11:case 12:case 13:case 32:break;case 101:{if(((b[404]|0)==0?fa(e)|0:0)?(Q(d+4|0,16,10)|0)==0:0){B();g=91}else g=91;break}case 105:{if(fa(e)|0?(Q(d+4|0,26,10)|0)==0:0){C();g=91}else g=91;break}case 99:{if((fa(e)|0?(Q(d+4|0,36,8)|0)==0:0)?pa(b[d+12>>1]|0)|0:0){a[814]=1;g=91}else g=91;break}case 40:{f=c[72]|0;d=b[404]|0;g=d&65535;c[f+(g<<3)>>2]=1;e=c[71]|0;b[404]=d+1<<16>>16;c[f+(g<<3)+4>>2]=e;g=91;break}case 41:{e=b[404]|0;if(!(e<<16>>16)){g=36;break c}f=e+-1<<16>>16;b[404]=f;g=b[403]|0;e=g&65535;if(g<<16>>16!=0?(c[(c[72]|0)+((f&65535)<<3)>>2]|0)==5:0){e=c[(c[73]|0)+(e+-1<<2)>>2]|0;f=e+4|0;if(!(c[f>>2]|0))c[f>>2]=(c[71]|0)+2;c[e+12>>2]=d+4;b[403]=g+-1<<16>>16;g=91}else g=91;break}case 123:{g=c[71]|0;f=c[65]|0;d=g;do if((b[g>>1]|0)==41&(f|0)!=0?(c[f+4>>2]|0)==(g|0):0){e=c[66]|0;c[65]=e;if(!e){c[61]=0;break}else{c[e+32>>2]=0;break}}while(0);f=c[72]|0;e=b[404]|0;g=e&65535;c[f+(g<<3)>>2]=(a[814]|0)==0?2:6;b[404]=e+1<<16>>16;c[f+(g<<3)+4>>2]=d;a[814]=0;g=91;break}case 125:{d=b[404]|0;if(!(d<<16>>16)){g=49;break c}f=c[72]|0;g=d+-1<<16>>16;b[404]=g;if((c[f+((g&65535)<<3)>>2]|0)==4){H();g=91}else g=91;break}case 39:{K(39);g=91;break}case 34:{K(34);g=91;break}case 47:switch(b[d+4>>1]|0){case 47:{$();break d}case 42:{P(1);break d}default:{d=c[71]|0;e=b[d>>1]|0;e:do if(!(T(e)|0))if(e<<16>>16==41){f=b[404]|0;if(!(ca(c[(c[72]|0)+((f&65535)<<3)+4>>2]|0)|0))g=65}else g=64;else switch(e<<16>>16){case 46:if(((b[d+-2>>1]|0)+-48&65535)<10){g=64;break e}else break e;case 43:if((b[d+-2>>1]|0)==43){g=64;break e}else break e;case 45:if((b[d+-2>>1]|0)==45){g=64;break e}else break e;default:break e}while(0);if((g|0)==64){f=b[404]|0;g=65}f:do if((g|0)==65){g=0;if(f<<16>>16!=0?(h=c[72]|0,i=(f&65535)+-1|0,e<<16>>16==102?(c[h+(i<<3)>>2]|0)==1:0):0){if((b[d+-2>>1]|0)==111?X(c[h+(i<<3)+4>>2]|0,44,3)|0:0)break}else g=69;if((g|0)==69?(0,e<<16>>16==125):0){g=c[72]|0;f=f&65535;if(O(c[g+(f<<3)+4>>2]|0)|0)break;if((c[g+(f<<3)>>2]|0)==6)break}if(!(E(d)|0)){switch(e<<16>>16){case 0:break f;case 47:{if(a[813]|0)break f;break}default:{}}g=c[67]|0;if((g|0?d>>>0>=(c[g>>2]|0)>>>0:0)?d>>>0<=(c[g+4>>2]|0)>>>0:0){N();a[813]=0;g=91;break d}f=c[3]|0;do{if(d>>>0<=f>>>0)break;d=d+-2|0;c[71]=d;e=b[d>>1]|0}while(!(_(e)|0));if(da(e)|0){do{if(d>>>0<=f>>>0)break;d=d+-2|0;c[71]=d}while(da(b[d>>1]|0)|0);if(Y(d)|0){N();a[813]=0;g=91;break d}}a[813]=1;g=91;break d}}while(0);N();a[813]=0;g=91;break d}}case 96:{f=c[72]|0;e=b[404]|0;g=e&65535;c[f+(g<<3)+4>>2]=c[71];b[404]=e+1<<16>>16;c[f+(g<<3)>>2]=3;H();g=91;break}default:g=91}while(0);if((g|0)==91){g=0;c[71]=c[74]}d=c[74]|0}if((g|0)==36){oa();d=0;break}else if((g|0)==49){oa();d=0;break}else if((g|0)==92){d=(a[810]|0)==0?(b[403]|b[404])<<16>>16==0:0;break}}while(0);v=j;return d|0}function B(){var d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0;k=c[74]|0;l=c[67]|0;q=k+12|0;c[74]=q;f=I(1)|0;d=c[74]|0;if(!((d|0)==(q|0)?!(S(f)|0):0))p=3;a:do if((p|0)==3){b:do switch(f<<16>>16){case 123:{c[74]=d+2;d=I(1)|0;e=c[74]|0;while(1){if(qa(d)|0){K(d);d=(c[74]|0)+2|0;c[74]=d}else{aa(d)|0;d=c[74]|0}I(1)|0;d=L(e,d)|0;if(d<<16>>16==44){c[74]=(c[74]|0)+2;d=I(1)|0}if(d<<16>>16==125){p=15;break}q=e;e=c[74]|0;if((e|0)==(q|0)){p=12;break}if(e>>>0>(c[75]|0)>>>0){p=14;break}}if((p|0)==12){oa();break a}else if((p|0)==14){oa();break a}else if((p|0)==15){a[811]=1;c[74]=(c[74]|0)+2;break b}break}case 42:{c[74]=d+2;I(1)|0;q=c[74]|0;L(q,q)|0;break}default:{a[812]=0;switch(f<<16>>16){case 100:{k=d+14|0;c[74]=k;switch((I(1)|0)<<16>>16){case 97:{e=c[74]|0;if((Q(e+2|0,80,8)|0)==0?(h=e+10|0,da(b[h>>1]|0)|0):0){c[74]=h;I(0)|0;p=22}break}case 102:{p=22;break}case 99:{e=c[74]|0;if(((Q(e+2|0,36,8)|0)==0?(g=e+10|0,q=b[g>>1]|0,pa(q)|0|q<<16>>16==123):0)?(c[74]=g,i=I(1)|0,i<<16>>16!=123):0){o=i;p=31}break}default:{}}c:do if((p|0)==22?(j=c[74]|0,(Q(j+2|0,88,14)|0)==0):0){f=j+16|0;e=b[f>>1]|0;if(!(pa(e)|0))switch(e<<16>>16){case 40:case 42:break;default:break c}c[74]=f;e=I(1)|0;if(e<<16>>16==42){c[74]=(c[74]|0)+2;e=I(1)|0}if(e<<16>>16!=40){o=e;p=31}}while(0);if((p|0)==31?(m=c[74]|0,aa(o)|0,n=c[74]|0,n>>>0>m>>>0):0){W(d,k,m,n);c[74]=(c[74]|0)+-2;break a}W(d,k,0,0);c[74]=d+12;break a}case 97:{c[74]=d+10;I(0)|0;d=c[74]|0;p=35;break}case 102:{p=35;break}case 99:{if((Q(d+2|0,36,8)|0)==0?(e=d+10|0,_(b[e>>1]|0)|0):0){c[74]=e;q=I(1)|0;p=c[74]|0;aa(q)|0;q=c[74]|0;W(p,q,p,q);c[74]=(c[74]|0)+-2;break a}d=d+4|0;c[74]=d;break}case 108:case 118:break;default:break a}if((p|0)==35){c[74]=d+16;d=I(1)|0;if(d<<16>>16==42){c[74]=(c[74]|0)+2;d=I(1)|0}p=c[74]|0;aa(d)|0;q=c[74]|0;W(p,q,p,q);c[74]=(c[74]|0)+-2;break a}c[74]=d+6;a[812]=0;f=I(1)|0;d=c[74]|0;f=(aa(f)|0|32)<<16>>16==123;g=c[74]|0;if(f){c[74]=g+2;q=I(1)|0;d=c[74]|0;aa(q)|0}d:while(1){e=c[74]|0;if((e|0)==(d|0))break;W(d,e,d,e);e=I(1)|0;if(f)switch(e<<16>>16){case 93:case 125:break a;default:{}}d=c[74]|0;if(e<<16>>16!=44){p=51;break}c[74]=d+2;e=I(1)|0;d=c[74]|0;switch(e<<16>>16){case 91:case 123:{p=51;break d}default:{}}aa(e)|0}if((p|0)==51)c[74]=d+-2;if(!f)break a;c[74]=g+-2;break a}}while(0);q=(I(1)|0)<<16>>16==102;d=c[74]|0;if(q?(Q(d+2|0,74,6)|0)==0:0){c[74]=d+8;D(k,I(1)|0,0);d=(l|0)==0?248:l+16|0;while(1){d=c[d>>2]|0;if(!d)break a;c[d+12>>2]=0;c[d+8>>2]=0;d=d+16|0}}c[74]=d+-2}while(0);return}function C(){var d=0,e=0,f=0,g=0,h=0,i=0,j=0;j=c[74]|0;h=j+12|0;c[74]=h;d=I(1)|0;g=c[74]|0;a:do if(d<<16>>16!=46){if(!(d<<16>>16==115&g>>>0>h>>>0)){if(!(d<<16>>16==100&g>>>0>(j+10|0)>>>0)){g=0;i=28;break}if(Q(g+2|0,66,8)|0){e=g;d=100;g=0;i=59;break}d=g+10|0;if(!(pa(b[d>>1]|0)|0)){e=g;d=100;g=0;i=59;break}c[74]=d;d=I(1)|0;if(d<<16>>16==42){d=42;g=2;i=61;break}c[74]=g;g=0;i=28;break}if((Q(g+2|0,56,10)|0)==0?(f=g+12|0,pa(b[f>>1]|0)|0):0){c[74]=f;d=I(1)|0;e=c[74]|0;if((e|0)!=(f|0)){if(d<<16>>16!=102){g=1;i=28;break}if(Q(e+2|0,74,6)|0){d=102;g=1;i=59;break}if(!(_(b[e+8>>1]|0)|0)){d=102;g=1;i=59;break}}c[74]=g;g=0;i=28}else{e=g;d=115;g=0;i=59}}else{c[74]=g+2;switch((I(1)|0)<<16>>16){case 109:{d=c[74]|0;if(Q(d+2|0,50,6)|0)break a;e=c[71]|0;if(!(ea(e)|0)?(b[e>>1]|0)==46:0)break a;J(j,j,d+8|0,2);break a}case 115:{d=c[74]|0;if(Q(d+2|0,56,10)|0)break a;e=c[71]|0;if(!(ea(e)|0)?(b[e>>1]|0)==46:0)break a;c[74]=d+12;d=I(1)|0;g=1;i=28;break a}case 100:{d=c[74]|0;if(Q(d+2|0,66,8)|0)break a;e=c[71]|0;if(!(ea(e)|0)?(b[e>>1]|0)==46:0)break a;c[74]=d+10;d=I(1)|0;g=2;i=28;break a}default:break a}}while(0);b:do if((i|0)==28){if(d<<16>>16==40){f=c[72]|0;e=b[404]|0;h=e&65535;c[f+(h<<3)>>2]=5;d=c[74]|0;b[404]=e+1<<16>>16;c[f+(h<<3)+4>>2]=d;if((b[c[71]>>1]|0)==46)break;c[74]=d+2;e=I(1)|0;J(j,c[74]|0,0,d);if(!g)d=c[65]|0;else{d=c[65]|0;c[d+28>>2]=(g|0)==1?5:7}h=c[73]|0;j=b[403]|0;b[403]=j+1<<16>>16;c[h+((j&65535)<<2)>>2]=d;switch(e<<16>>16){case 39:{K(39);break}case 34:{K(34);break}default:{c[74]=(c[74]|0)+-2;break b}}d=(c[74]|0)+2|0;c[74]=d;switch((I(1)|0)<<16>>16){case 44:{c[74]=(c[74]|0)+2;I(1)|0;h=c[65]|0;c[h+4>>2]=d;j=c[74]|0;c[h+16>>2]=j;a[h+24>>0]=1;c[74]=j+-2;break b}case 41:{b[404]=(b[404]|0)+-1<<16>>16;j=c[65]|0;c[j+4>>2]=d;c[j+12>>2]=(c[74]|0)+2;a[j+24>>0]=1;b[403]=(b[403]|0)+-1<<16>>16;break b}default:{c[74]=(c[74]|0)+-2;break b}}}if(!((g|0)==0&d<<16>>16==123)){switch(d<<16>>16){case 42:case 39:case 34:{i=61;break b}default:{}}e=c[74]|0;i=59;break}d=c[74]|0;if(b[404]|0){c[74]=d+-2;break}while(1){if(d>>>0>=(c[75]|0)>>>0)break;d=I(1)|0;if(!(qa(d)|0)){if(d<<16>>16==125){i=49;break}}else K(d);d=(c[74]|0)+2|0;c[74]=d}if((i|0)==49)c[74]=(c[74]|0)+2;h=(I(1)|0)<<16>>16==102;d=c[74]|0;if(h?Q(d+2|0,74,6)|0:0){oa();break}c[74]=d+8;d=I(1)|0;if(qa(d)|0){D(j,d,0);break}else{oa();break}}while(0);if((i|0)==59)if((e|0)==(h|0))c[74]=j+10;else i=61;do if((i|0)==61){if(!((d<<16>>16==42|(g|0)!=2)&(b[404]|0)==0)){c[74]=(c[74]|0)+-2;break}d=c[75]|0;e=c[74]|0;while(1){if(e>>>0>=d>>>0){i=68;break}f=b[e>>1]|0;if(qa(f)|0){i=66;break}i=e+2|0;c[74]=i;e=i}if((i|0)==66){D(j,f,g);break}else if((i|0)==68){oa();break}}while(0);return}function D(a,d,e){a=a|0;d=d|0;e=e|0;var f=0,g=0;f=(c[74]|0)+2|0;switch(d<<16>>16){case 39:{K(39);g=5;break}case 34:{K(34);g=5;break}default:oa()}do if((g|0)==5){J(a,f,c[74]|0,1);if((e|0)>0)c[(c[65]|0)+28>>2]=(e|0)==1?4:6;c[74]=(c[74]|0)+2;d=I(0)|0;e=d<<16>>16==97;if(e){f=c[74]|0;if(Q(f+2|0,102,10)|0)g=13}else{f=c[74]|0;if(!(((d<<16>>16==119?(b[f+2>>1]|0)==105:0)?(b[f+4>>1]|0)==116:0)?(b[f+6>>1]|0)==104:0))g=13}if((g|0)==13){c[74]=f+-2;break}c[74]=f+((e?6:4)<<1);if((I(1)|0)<<16>>16!=123){c[74]=f;break}e=c[74]|0;d=e;a:while(1){c[74]=d+2;d=I(1)|0;switch(d<<16>>16){case 39:{K(39);c[74]=(c[74]|0)+2;d=I(1)|0;break}case 34:{K(34);c[74]=(c[74]|0)+2;d=I(1)|0;break}default:d=aa(d)|0}if(d<<16>>16!=58){g=22;break}c[74]=(c[74]|0)+2;switch((I(1)|0)<<16>>16){case 39:{K(39);break}case 34:{K(34);break}default:{g=26;break a}}c[74]=(c[74]|0)+2;switch((I(1)|0)<<16>>16){case 125:{g=31;break a}case 44:break;default:{g=30;break a}}c[74]=(c[74]|0)+2;if((I(1)|0)<<16>>16==125){g=31;break}d=c[74]|0}if((g|0)==22){c[74]=f;break}else if((g|0)==26){c[74]=f;break}else if((g|0)==30){c[74]=f;break}else if((g|0)==31){g=c[65]|0;c[g+16>>2]=e;c[g+12>>2]=(c[74]|0)+2;break}}while(0);return}function E(a){a=a|0;a:do switch(b[a>>1]|0){case 100:switch(b[a+-2>>1]|0){case 105:{a=X(a+-4|0,112,2)|0;break a}case 108:{a=X(a+-4|0,116,3)|0;break a}default:{a=0;break a}}case 101:switch(b[a+-2>>1]|0){case 115:switch(b[a+-4>>1]|0){case 108:{a=Z(a+-6|0,101)|0;break a}case 97:{a=Z(a+-6|0,99)|0;break a}default:{a=0;break a}}case 116:{a=X(a+-4|0,122,4)|0;break a}case 117:{a=X(a+-4|0,130,6)|0;break a}default:{a=0;break a}}case 102:{if((b[a+-2>>1]|0)==111?(b[a+-4>>1]|0)==101:0)switch(b[a+-6>>1]|0){case 99:{a=X(a+-8|0,142,6)|0;break a}case 112:{a=X(a+-8|0,154,2)|0;break a}default:{a=0;break a}}else a=0;break}case 107:{a=X(a+-2|0,158,4)|0;break}case 110:{a=a+-2|0;if(Z(a,105)|0)a=1;else a=X(a,166,5)|0;break}case 111:{a=Z(a+-2|0,100)|0;break}case 114:{a=X(a+-2|0,176,7)|0;break}case 116:{a=X(a+-2|0,190,4)|0;break}case 119:switch(b[a+-2>>1]|0){case 101:{a=Z(a+-4|0,110)|0;break a}case 111:{a=X(a+-4|0,198,3)|0;break a}default:{a=0;break a}}default:a=0}while(0);return a|0}function H(){var a=0,d=0,e=0,f=0;d=c[75]|0;e=c[74]|0;a:while(1){a=e+2|0;if(e>>>0>=d>>>0){d=10;break}switch(b[a>>1]|0){case 96:{d=7;break a}case 36:{if((b[e+4>>1]|0)==123){d=6;break a}break}case 92:{a=e+4|0;break}default:{}}e=a}if((d|0)==6){a=e+4|0;c[74]=a;d=c[72]|0;f=b[404]|0;e=f&65535;c[d+(e<<3)>>2]=4;b[404]=f+1<<16>>16;c[d+(e<<3)+4>>2]=a}else if((d|0)==7){c[74]=a;e=c[72]|0;f=(b[404]|0)+-1<<16>>16;b[404]=f;if((c[e+((f&65535)<<3)>>2]|0)!=3)oa()}else if((d|0)==10){c[74]=a;oa()}return}function I(a){a=a|0;var d=0,e=0,f=0;e=c[74]|0;a:do{d=b[e>>1]|0;b:do if(d<<16>>16!=47)if(a)if(pa(d)|0)break;else break a;else if(da(d)|0)break;else break a;else switch(b[e+2>>1]|0){case 47:{$();break b}case 42:{P(a);break b}default:{d=47;break a}}while(0);f=c[74]|0;e=f+2|0;c[74]=e}while(f>>>0<(c[75]|0)>>>0);return d|0}function J(b,d,e,f){b=b|0;d=d|0;e=e|0;f=f|0;var g=0,h=0;h=c[69]|0;c[69]=h+36;g=c[65]|0;c[((g|0)==0?244:g+32|0)>>2]=h;c[66]=g;c[65]=h;c[h+8>>2]=b;if(2==(f|0)){b=3;g=e}else{g=1==(f|0);b=g?1:2;g=g?e+2|0:0}c[h+12>>2]=g;c[h+28>>2]=b;c[h>>2]=d;c[h+4>>2]=e;c[h+16>>2]=0;c[h+20>>2]=f;d=1==(f|0);a[h+24>>0]=d&1;c[h+32>>2]=0;if(d|2==(f|0))a[811]=1;return}function K(a){a=a|0;var d=0,e=0,f=0,g=0;g=c[75]|0;d=c[74]|0;while(1){f=d+2|0;if(d>>>0>=g>>>0){d=9;break}e=b[f>>1]|0;if(e<<16>>16==a<<16>>16){d=10;break}if(e<<16>>16==92){e=d+4|0;if((b[e>>1]|0)==13){d=d+6|0;d=(b[d>>1]|0)==10?d:e}else d=e}else if(ta(e)|0){d=9;break}else d=f}if((d|0)==9){c[74]=f;oa()}else if((d|0)==10)c[74]=f;return}function L(a,d){a=a|0;d=d|0;var e=0,f=0,g=0,h=0;e=c[74]|0;f=b[e>>1]|0;h=(a|0)==(d|0);g=h?0:a;h=h?0:d;if(f<<16>>16==97){c[74]=e+4;e=I(1)|0;a=c[74]|0;if(qa(e)|0){K(e);d=(c[74]|0)+2|0;c[74]=d}else{aa(e)|0;d=c[74]|0}f=I(1)|0;e=c[74]|0}if((e|0)!=(a|0))W(a,d,g,h);return f|0}function M(){var a=0,d=0,e=0;e=c[75]|0;d=c[74]|0;a:while(1){a=d+2|0;if(d>>>0>=e>>>0){d=6;break}switch(b[a>>1]|0){case 13:case 10:{d=6;break a}case 93:{d=7;break a}case 92:{a=d+4|0;break}default:{}}d=a}if((d|0)==6){c[74]=a;oa();a=0}else if((d|0)==7){c[74]=a;a=93}return a|0}function N(){var a=0,d=0,e=0;a:while(1){a=c[74]|0;d=a+2|0;c[74]=d;if(a>>>0>=(c[75]|0)>>>0){e=7;break}switch(b[d>>1]|0){case 13:case 10:{e=7;break a}case 47:break a;case 91:{M()|0;break}case 92:{c[74]=a+4;break}default:{}}}if((e|0)==7)oa();return}function O(a){a=a|0;switch(b[a>>1]|0){case 62:{a=(b[a+-2>>1]|0)==61;break}case 41:case 59:{a=1;break}case 104:{a=X(a+-2|0,218,4)|0;break}case 121:{a=X(a+-2|0,226,6)|0;break}case 101:{a=X(a+-2|0,238,3)|0;break}default:a=0}return a|0}function P(a){a=a|0;var d=0,e=0,f=0,g=0,h=0;g=(c[74]|0)+2|0;c[74]=g;e=c[75]|0;while(1){d=g+2|0;if(g>>>0>=e>>>0)break;f=b[d>>1]|0;if(!a?ta(f)|0:0)break;if(f<<16>>16==42?(b[g+4>>1]|0)==47:0){h=8;break}g=d}if((h|0)==8){c[74]=d;d=g+4|0}c[74]=d;return}function Q(b,c,d){b=b|0;c=c|0;d=d|0;var e=0,f=0;a:do if(!d)b=0;else{while(1){e=a[b>>0]|0;f=a[c>>0]|0;if(e<<24>>24!=f<<24>>24)break;d=d+-1|0;if(!d){b=0;break a}else{b=b+1|0;c=c+1|0}}b=(e&255)-(f&255)|0}while(0);return b|0}function S(a){a=a|0;a:do switch(a<<16>>16){case 38:case 37:case 33:{a=1;break}default:if((a&-8)<<16>>16==40|(a+-58&65535)<6)a=1;else{switch(a<<16>>16){case 91:case 93:case 94:{a=1;break a}default:{}}a=(a+-123&65535)<4}}while(0);return a|0}function T(a){a=a|0;a:do switch(a<<16>>16){case 38:case 37:case 33:break;default:if(!((a+-58&65535)<6|(a+-40&65535)<7&a<<16>>16!=41)){switch(a<<16>>16){case 91:case 94:break a;default:{}}return a<<16>>16!=125&(a+-123&65535)<4|0}}while(0);return 1}function U(a){a=a|0;var c=0;c=b[a>>1]|0;a:do if((c+-9&65535)>=5){switch(c<<16>>16){case 160:case 32:{c=1;break a}default:{}}if(S(c)|0)return c<<16>>16!=46|(ea(a)|0)|0;else c=0}else c=1;while(0);return c|0}function V(a){a=a|0;var d=0,e=0,f=0,g=0;e=v;v=v+16|0;f=e;c[f>>2]=0;c[68]=a;d=c[3]|0;g=d+(a<<1)|0;a=g+2|0;b[g>>1]=0;c[f>>2]=a;c[69]=a;c[61]=0;c[65]=0;c[63]=0;c[62]=0;c[67]=0;c[64]=0;v=e;return d|0}function W(b,d,e,f){b=b|0;d=d|0;e=e|0;f=f|0;var g=0,h=0;g=c[69]|0;c[69]=g+20;h=c[67]|0;c[((h|0)==0?248:h+16|0)>>2]=g;c[67]=g;c[g>>2]=b;c[g+4>>2]=d;c[g+8>>2]=e;c[g+12>>2]=f;c[g+16>>2]=0;a[811]=1;return}function X(a,b,d){a=a|0;b=b|0;d=d|0;var e=0,f=0;e=a+(0-d<<1)|0;f=e+2|0;a=c[3]|0;if(f>>>0>=a>>>0?(Q(f,b,d<<1)|0)==0:0)if((f|0)==(a|0))a=1;else a=U(e)|0;else a=0;return a|0}function Y(a){a=a|0;switch(b[a>>1]|0){case 107:{a=X(a+-2|0,158,4)|0;break}case 101:{if((b[a+-2>>1]|0)==117)a=X(a+-4|0,130,6)|0;else a=0;break}default:a=0}return a|0}function Z(a,d){a=a|0;d=d|0;var e=0;e=c[3]|0;if(e>>>0<=a>>>0?(b[a>>1]|0)==d<<16>>16:0)if((e|0)==(a|0))e=1;else e=_(b[a+-2>>1]|0)|0;else e=0;return e|0}function _(a){a=a|0;a:do if((a+-9&65535)<5)a=1;else{switch(a<<16>>16){case 32:case 160:{a=1;break a}default:{}}a=a<<16>>16!=46&(S(a)|0)}while(0);return a|0}function $(){var a=0,d=0,e=0;a=c[75]|0;e=c[74]|0;a:while(1){d=e+2|0;if(e>>>0>=a>>>0)break;switch(b[d>>1]|0){case 13:case 10:break a;default:e=d}}c[74]=d;return}function aa(a){a=a|0;while(1){if(pa(a)|0)break;if(S(a)|0)break;a=(c[74]|0)+2|0;c[74]=a;a=b[a>>1]|0;if(!(a<<16>>16)){a=0;break}}return a|0}function ba(){var a=0;a=c[(c[63]|0)+20>>2]|0;switch(a|0){case 1:{a=-1;break}case 2:{a=-2;break}default:a=a-(c[3]|0)>>1}return a|0}function ca(a){a=a|0;if(!(X(a,204,5)|0)?!(X(a,44,3)|0):0)a=X(a,214,2)|0;else a=1;return a|0}function da(a){a=a|0;switch(a<<16>>16){case 160:case 32:case 12:case 11:case 9:{a=1;break}default:a=0}return a|0}function ea(a){a=a|0;if((b[a>>1]|0)==46?(b[a+-2>>1]|0)==46:0)a=(b[a+-4>>1]|0)==46;else a=0;return a|0}function fa(a){a=a|0;if((c[3]|0)==(a|0))a=1;else a=U(a+-2|0)|0;return a|0}function ga(){var a=0;a=c[(c[64]|0)+12>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ha(){var a=0;a=c[(c[63]|0)+12>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ia(){var a=0;a=c[(c[64]|0)+8>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ja(){var a=0;a=c[(c[63]|0)+16>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function ka(){var a=0;a=c[(c[63]|0)+4>>2]|0;if(!a)a=-1;else a=a-(c[3]|0)>>1;return a|0}function la(){var a=0;a=c[63]|0;a=c[((a|0)==0?244:a+32|0)>>2]|0;c[63]=a;return (a|0)!=0|0}function ma(){var a=0;a=c[64]|0;a=c[((a|0)==0?248:a+16|0)>>2]|0;c[64]=a;return (a|0)!=0|0}function oa(){a[810]=1;c[70]=(c[74]|0)-(c[3]|0)>>1;c[74]=(c[75]|0)+2;return}function pa(a){a=a|0;return (a|128)<<16>>16==160|(a+-9&65535)<5|0}function qa(a){a=a|0;return a<<16>>16==39|a<<16>>16==34|0}function ra(){return (c[(c[63]|0)+8>>2]|0)-(c[3]|0)>>1|0}function sa(){return (c[(c[64]|0)+4>>2]|0)-(c[3]|0)>>1|0}function ta(a){a=a|0;return a<<16>>16==13|a<<16>>16==10|0}function ua(){return (c[c[63]>>2]|0)-(c[3]|0)>>1|0}function va(){return (c[c[64]>>2]|0)-(c[3]|0)>>1|0}function wa(){return d[(c[63]|0)+24>>0]|0|0}function xa(a){a=a|0;c[3]=a;return}function ya(){return c[(c[63]|0)+28>>2]|0}function Ba(){return (a[811]|0)!=0|0}function Ca(){return (a[812]|0)!=0|0}function Ga(){return c[70]|0}  function su(a) {
-		a = a | 0;
-		v = a + 992 + 15 & -16;
-		return 992;
-	}
-	return {
-		su,ai:ja,e:Ga,ee:sa,ele:ga,els:ia,es:va,f:Ca,id:ba,ie:ka,ip:wa,is:ua,it:ya,ms:Ba,p:z,re:ma,ri:la,sa:V,se:ha,ses:xa,ss:ra}}
\ No newline at end of file
+function asmInit(global, env, buffer) {
+  var HEAP8 = new global.Int8Array(buffer), HEAP16 = new global.Int16Array(buffer), HEAP32 = new global.Int32Array(buffer);
+  var HEAPU8 = new global.Uint8Array(buffer), HEAPU16 = new global.Uint16Array(buffer), HEAPU32 = new global.Uint32Array(buffer);
+  var sp = 0;
+  HEAPU8.set([0,0], 1024);
+  HEAPU8.set([0,32,32,32,32,32,32,32,32,11,10,11,11,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,11,28,0,32,32,28,28,0,28,12,28,28,28,28,20,12,32,32,32,32,32,32,32,32,32,32,28,28,28,28,28,28,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,28,32,12,28,32,0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,28,28,12,28,32], 1040);
+  HEAPU8.set([1,0,0,0], 1168);
+  HEAPU8.set([2,0,0,0], 1172);
+  HEAPU8.set([0,4,0,0], 1176);
+  HEAPU8.set([32,5,0,0], 1180);
+  function ctz32(x) { return x ? 31 - Math.clz32(x & -x) : 32; }
+  function popcnt32(x) { x = x - (x >>> 1 & 0x55555555); x = (x & 0x33333333) + (x >>> 2 & 0x33333333); return Math.imul(x + (x >>> 4) & 0x0f0f0f0f, 0x01010101) >>> 24; }
+  function rotl32(x, y) { y &= 31; return x << y | x >>> (32 - y); }
+  function ld16a0(a) { return HEAPU8[a] | HEAP8[a + 1] << 8; }
+  function ldU16a0(a) { return HEAPU8[a] | HEAPU8[a + 1] << 8; }
+  function ld32a0(a) { return HEAPU8[a] | HEAPU8[a + 1] << 8 | HEAPU8[a + 2] << 16 | HEAPU8[a + 3] << 24; }
+  function ld32a1(a) { return HEAPU16[a >> 1] | HEAPU16[a + 2 >> 1] << 16; }
+  function ldU32a0(a) { return ld32a0(a) >>> 0; }
+  function ldU32a1(a) { return ld32a1(a) >>> 0; }
+  function st16a0(a, v) { HEAP8[a] = v; HEAP8[a + 1] = v >> 8; }
+  function st32a0(a, v) { HEAP8[a] = v; HEAP8[a + 1] = v >> 8; HEAP8[a + 2] = v >> 16; HEAP8[a + 3] = v >> 24; }
+  function st32a1(a, v) { HEAP16[a >> 1] = v; HEAP16[a + 2 >> 1] = v >> 16; }
+  function st32a2(a, v) { HEAP32[a >> 2] = v; }
+  function ld32a2(a) { return HEAP32[a >> 2]; }
+  function ld64a0(a) { return BigInt(ld32a0(a) >>> 0) | BigInt(ld32a0(a + 4)) << 32n; }
+  function ld64a1(a) { return BigInt(ld32a1(a) >>> 0) | BigInt(ld32a1(a + 4)) << 32n; }
+  function ld64a2(a) { return BigInt(HEAPU32[a >> 2]) | BigInt(HEAP32[a + 4 >> 2]) << 32n; }
+  function st64a0(a, v) { st32a0(a, Number(BigInt.asIntN(32, v))); st32a0(a + 4, Number(BigInt.asIntN(32, v >> 32n))); }
+  function st64a1(a, v) { st32a1(a, Number(BigInt.asIntN(32, v))); st32a1(a + 4, Number(BigInt.asIntN(32, v >> 32n))); }
+  function st64a2(a, v) { HEAP32[a >> 2] = Number(BigInt.asIntN(32, v)); HEAP32[a + 4 >> 2] = Number(BigInt.asIntN(32, v >> 32n)); }
+  function clz64(x) { x = BigInt.asUintN(64, x); const h = Number(x >> 32n); return BigInt(h ? Math.clz32(h) : 32 + Math.clz32(Number(x & 0xffffffffn))); }
+  function ctz64(x) { x = BigInt.asUintN(64, x); const l = Number(x & 0xffffffffn); return BigInt(l ? ctz32(l) : 32 + ctz32(Number(x >> 32n))); }
+function f0(l0){HEAP32[(0 + 1180) >> 2] = l0;}
+function f1(l0){var l1 = 0;HEAP32[(0 + 1224) >> 2] = l0;l1 = HEAP32[(0 + 1180) >> 2];l0 = l1 + (l0 << 1) | 0;HEAP16[(l0) >> 1] = 0;l0 = (l0 + 9 | 0) & -8;HEAP32[(0 + 1240) >> 2] = l0;HEAP32[(0 + 1244) >> 2] = l0;HEAP32[(0 + 1228) >> 2] = 0;HEAP32[(0 + 1184) >> 2] = 0;HEAP32[(0 + 1200) >> 2] = 0;HEAP32[(0 + 1192) >> 2] = 0;HEAP32[(0 + 1188) >> 2] = 0;HEAP32[(0 + 1208) >> 2] = 0;HEAP32[(0 + 1196) >> 2] = 0;HEAP32[(0 + 1212) >> 2] = 0;HEAP32[(0 + 1216) >> 2] = 0;return l1;}
+function f2(l0,l1,l2,l3){var l4 = 0,l5 = 0,l6 = 0;l4 = HEAP32[(0 + 1200) >> 2];l5 = HEAP32[(0 + 1244) >> 2];HEAP32[(0 + 1200) >> 2] = l5;HEAP32[(0 + 1204) >> 2] = l4;HEAP32[(0 + 1244) >> 2] = l5 + 40 | 0;HEAP32[(l4 ? (l4 + 36 | 0) : 1184) >> 2] = l5;l4 = HEAP32[(0 + 1172) >> 2];l6 = HEAP32[(0 + 1168) >> 2];HEAP32[(l5) >> 2] = l1;HEAP32[(l5 + 8) >> 2] = l0;l0 = (l6 == l3) | 0;l4 = (l4 == l3) | 0;HEAP32[(l5 + 12) >> 2] = l4 ? l2 : (l0 ? (l2 + 2 | 0) : 0);HEAP32[(l5 + 20) >> 2] = l3;HEAP32[(l5 + 16) >> 2] = 0;HEAP32[(l5 + 4) >> 2] = l2;HEAP32[(l5 + 28) >> 2] = l4 ? 3 : (l0 ? 1 : 2);l2 = HEAP32[(0 + 1168) >> 2];HEAP8[l5 + 24] = (l2 == l3) | 0;HEAP32[(l5 + 36) >> 2] = 0;HEAP8[l5 + 32] = HEAPU8[0 + 1222];L0: {L1: {if ((HEAP32[(0 + 1172) >> 2]) == l3) {break L1;}if (l2 != l3) {break L0;}}HEAP8[0 + 1248] = 1;}}
+function f3(l0,l1,l2,l3){var l4 = 0,t0 = 0;l4 = HEAP32[(0 + 1208) >> 2];t0 = l4 ? (l4 + 20 | 0) : 1188;l4 = HEAP32[(0 + 1244) >> 2];HEAP32[(t0) >> 2] = l4;HEAP32[(0 + 1208) >> 2] = l4;HEAP32[(0 + 1244) >> 2] = l4 + 24 | 0;HEAP8[0 + 1248] = 1;HEAP8[l4 + 16] = HEAPU8[0 + 1222];HEAP32[(l4 + 12) >> 2] = l3;HEAP32[(l4 + 8) >> 2] = l2;HEAP32[(l4 + 4) >> 2] = l1;HEAP32[(l4 + 20) >> 2] = 0;HEAP32[(l4) >> 2] = l0;}
+function f4(l0){HEAP32[(0 + 1228) >> 2] = l0;}
+function f5(){return HEAP32[(0 + 1252) >> 2];}
+function f6(){return HEAPU8[0 + 1232];}
+function f7(){return ((HEAP32[(HEAP32[(0 + 1192) >> 2]) >> 2]) - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1;}
+function f8(){var l0 = 0;l0 = HEAP32[((HEAP32[(0 + 1192) >> 2]) + 4) >> 2];return l0 ? ((l0 - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1) : -1;}
+function f9(){return ((HEAP32[((HEAP32[(0 + 1192) >> 2]) + 8) >> 2]) - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1;}
+function f10(){var l0 = 0;l0 = HEAP32[((HEAP32[(0 + 1192) >> 2]) + 12) >> 2];return l0 ? ((l0 - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1) : -1;}
+function f11(){return HEAP32[((HEAP32[(0 + 1192) >> 2]) + 28) >> 2];}
+function f12(){var l0 = 0;l0 = HEAP32[((HEAP32[(0 + 1192) >> 2]) + 16) >> 2];return l0 ? ((l0 - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1) : -1;}
+function f13(){var l0 = 0;L0: {l0 = HEAP32[((HEAP32[(0 + 1192) >> 2]) + 20) >> 2];if (l0 != (HEAP32[(0 + 1168) >> 2])) {break L0;}return -1;}L1: {if (l0 != (HEAP32[(0 + 1172) >> 2])) {break L1;}return -2;}return (l0 - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1;}
+function f14(){return HEAPU8[(HEAP32[(0 + 1192) >> 2]) + 24];}
+function f15(){return ((HEAP32[(HEAP32[(0 + 1196) >> 2]) >> 2]) - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1;}
+function f16(){return ((HEAP32[((HEAP32[(0 + 1196) >> 2]) + 4) >> 2]) - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1;}
+function f17(){var l0 = 0;l0 = HEAP32[((HEAP32[(0 + 1196) >> 2]) + 8) >> 2];return l0 ? ((l0 - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1) : -1;}
+function f18(){var l0 = 0;l0 = HEAP32[((HEAP32[(0 + 1196) >> 2]) + 12) >> 2];return l0 ? ((l0 - (HEAP32[(0 + 1180) >> 2]) | 0) >> 1) : -1;}
+function f19(){var l0 = 0;l0 = HEAP32[(0 + 1192) >> 2];l0 = HEAP32[(l0 ? (l0 + 36 | 0) : 1184) >> 2];HEAP32[(0 + 1192) >> 2] = l0;return (l0 != 0) | 0;}
+function f20(){var l0 = 0;l0 = HEAP32[(0 + 1196) >> 2];l0 = HEAP32[(l0 ? (l0 + 20 | 0) : 1188) >> 2];HEAP32[(0 + 1196) >> 2] = l0;return (l0 != 0) | 0;}
+function f21(){return HEAPU8[0 + 1256];}
+function f22(){return HEAPU8[0 + 1248];}
+function f23(){var l0 = 0,t0 = 0;HEAP8[0 + 1220] = 1;t0 = f24();l0 = t0;HEAP8[0 + 1220] = 0;return l0;}
+function f24(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0,l4 = 0,l5 = 0,l6 = 0,t0 = 0,t1 = 0,t2 = 0,t3 = 0,t4 = 0,t5 = 0,t6 = 0,t7 = 0,t8 = 0,t9 = 0,t10 = 0,t11 = 0,t12 = 0,t13 = 0,t14 = 0,t15 = 0,t16 = 0,t17 = 0;l0 = sp - 10240 | 0;sp = l0;HEAP8[0 + 1256] = 1;l1 = HEAP32[(0 + 1176) >> 2];HEAP32[(0 + 1264) >> 2] = l1;HEAP8[0 + 1248] = 0;HEAP16[(0 + 1258) >> 1] = 0;HEAP16[(0 + 1260) >> 1] = 0;HEAP32[(0 + 1268) >> 2] = 0;HEAP16[(0 + 1272) >> 1] = 0;HEAP32[(0 + 1276) >> 2] = 0;HEAP8[0 + 1280] = 0;HEAP32[(0 + 1252) >> 2] = 0;HEAP8[0 + 1223] = 0;HEAP32[(0 + 1284) >> 2] = l0 + 2048 | 0;HEAP16[(l0 + 2048) >> 1] = 2;HEAP32[(0 + 1288) >> 2] = l0;HEAP32[(l0 + 2052) >> 2] = l1;l1 = (HEAP32[(0 + 1180) >> 2]) + -2 | 0;l2 = HEAP32[(0 + 1224) >> 2];l3 = l1 + (l2 << 1) | 0;HEAP32[(0 + 1300) >> 2] = l3;HEAP8[0 + 1292] = 0;HEAP8[0 + 1232] = 0;HEAP32[(0 + 1236) >> 2] = 0;L0: {l4 = HEAP32[(0 + 1228) >> 2];if (l4 == 0) {break L0;}if (l4 >>> 0 >= l2 >>> 0) {break L0;}l3 = l1 + (l4 << 1) | 0;HEAP32[(0 + 1300) >> 2] = l3;}L1: {L2: {L3: {L4: {L5: while (1) {l4 = l1 + 2 | 0;HEAP32[(0 + 1296) >> 2] = l4;if (l1 >>> 0 >= l3 >>> 0) {break L4;}L6: {l3 = HEAPU16[(l4) >> 1];if ((l3 + -9 | 0) >>> 0 < 5 >>> 0) {break L6;}L7: {L8: {L9: {L10: {L11: {switch (l3 + -101 | 0) {  case 0:break L10;  case 1: case 2: case 3:break L3;  case 4:break L9;  default:break L11;}}if (l3 == 32) {break L6;}if (l3 == 47) {break L8;}if (l3 == 59) {break L7;}break L3;}if (HEAPU16[(0 + 1260) >> 1]) {break L7;}t0 = f46(l4);if (t0 == 0) {break L7;}t1 = f33(l4);if (t1 == 0) {break L7;}f51();f52(l4);L12: {if ((HEAPU8[0 + 1220]) == 0) {break L12;}if (((HEAPU8[0 + 1248]) & 255) == 0) {break L12;}l3 = ((HEAPU8[0 + 1223]) == 0) | 0;break L1;}if (HEAPU8[0 + 1256]) {break L7;}l1 = HEAP32[(0 + 1296) >> 2];HEAP32[(0 + 1264) >> 2] = l1;break L2;}t2 = f46(l4);if (t2 == 0) {break L7;}t3 = f36(l4);if (t3 == 0) {break L7;}f53();f52(l4);if ((HEAPU8[0 + 1220]) == 0) {break L7;}if (((HEAPU8[0 + 1248]) & 255) == 0) {break L7;}l3 = ((HEAPU8[0 + 1223]) == 0) | 0;break L1;}L13: {l4 = HEAPU16[(l1 + 4) >> 1];if (l4 == 42) {break L13;}if (l4 != 47) {break L3;}f54();break L6;}f55(1);break L6;}HEAP32[(0 + 1264) >> 2] = HEAP32[(0 + 1296) >> 2];}l3 = HEAP32[(0 + 1300) >> 2];l1 = HEAP32[(0 + 1296) >> 2];continue L5;}}l3 = 0;l1 = l4;if ((HEAPU8[0 + 1223]) == 0) {break L2;}if ((HEAPU8[0 + 1232]) == 0) {break L1;}f56();break L1;}HEAP8[0 + 1256] = 0;}L14: while (1) {l4 = l1 + 2 | 0;HEAP32[(0 + 1296) >> 2] = l4;L15: {L16: {L17: {l2 = HEAP32[(0 + 1300) >> 2];if (l1 >>> 0 >= l2 >>> 0) {break L17;}L18: {l5 = HEAPU16[(l4) >> 1];l3 = l5 + -9 | 0;if (l3 >>> 0 > 23 >>> 0) {break L18;}if ((1 << l3) & 8388639) {break L15;}}L19: {l3 = HEAP32[(0 + 1264) >> 2];if (l3 == l1) {break L19;}L20: {l6 = HEAPU16[(l3) >> 1];if (l6 == 107) {break L20;}if (l6 != 101) {break L19;}}t4 = f57(l4);if (t4 == 0) {break L19;}l1 = l1 + 4 | 0;L21: {L22: while (1) {l3 = l1 + -2 | 0;if (l3 >>> 0 >= l2 >>> 0) {break L21;}l4 = HEAPU16[(l1) >> 1];t5 = f58(l4);if (t5) {break L21;}if (l4 == 34) {break L21;}if (l4 == 39) {break L21;}if (l4 == 96) {break L21;}HEAP32[(0 + 1296) >> 2] = l1;l1 = l1 + 2 | 0;continue L22;}}HEAP32[(0 + 1264) >> 2] = l3;HEAP32[(0 + 1268) >> 2] = l3;break L15;}L23: {L24: {L25: {L26: {L27: {L28: {L29: {L30: {L31: {L32: {L33: {switch (l5 + -39 | 0) {  case 0:break L28;  case 1:break L32;  case 2:break L31;  case 3: case 4: case 5: case 6: case 7:break L23;  case 8:break L26;  default:break L33;}}L34: {L35: {L36: {L37: {switch (l5 + -96 | 0) {  case 0:break L25;  case 1: case 2: case 4: case 6: case 7: case 8:break L23;  case 3:break L34;  case 5:break L36;  case 9:break L35;  default:break L37;}}switch (l5 + -123 | 0) {  case 0:break L30;  case 1:break L23;  case 2:break L29;  default:break L27;}}if (HEAPU16[(0 + 1260) >> 1]) {break L23;}t6 = f46(l4);if (t6 == 0) {break L23;}t7 = f33(l4);if (t7 == 0) {break L23;}f51();f52(l4);if ((HEAPU8[0 + 1220]) == 0) {break L23;}if (((HEAPU8[0 + 1248]) & 255) == 0) {break L23;}l3 = ((HEAPU8[0 + 1223]) == 0) | 0;break L1;}t8 = f46(l4);if (t8 == 0) {break L23;}t9 = f36(l4);if (t9 == 0) {break L23;}f53();f52(l4);if ((HEAPU8[0 + 1220]) == 0) {break L23;}if (((HEAPU8[0 + 1248]) & 255) == 0) {break L23;}l3 = ((HEAPU8[0 + 1223]) == 0) | 0;break L1;}t10 = f46(l4);if (t10 == 0) {break L23;}t11 = f28(l4);if (t11 == 0) {break L23;}t12 = f59(HEAPU16[(l1 + 12) >> 1]);if (t12 == 0) {break L23;}HEAP8[0 + 1292] = 1;break L23;}l4 = HEAPU16[(0 + 1260) >> 1];l1 = (HEAP32[(0 + 1284) >> 2]) + (l4 << 3) | 0;HEAP8[l1] = 1;t13 = f49(l3);l2 = t13;HEAP16[(0 + 1260) >> 1] = l4 + 1 | 0;HEAP8[l1 + 1] = l2;HEAP32[(l1 + 4) >> 2] = l3;break L23;}l4 = HEAPU16[(0 + 1260) >> 1];if (l4 == 0) {break L16;}l4 = l4 + -1 | 0;HEAP16[(0 + 1260) >> 1] = l4;l2 = HEAPU16[(0 + 1258) >> 1];if (l2 == 0) {break L23;}if ((HEAPU8[(HEAP32[(0 + 1284) >> 2]) + ((l4 & 65535) << 3) | 0]) != 5) {break L23;}L38: {l4 = HEAP32[(((l2 << 2) + (HEAP32[(0 + 1288) >> 2]) | 0) + -4 | 0) >> 2];if (HEAP32[(l4 + 4) >> 2]) {break L38;}HEAP32[(l4 + 4) >> 2] = l3 + 2 | 0;}HEAP16[(0 + 1258) >> 1] = l2 + -1 | 0;HEAP32[(l4 + 12) >> 2] = l1 + 4 | 0;break L23;}L39: {if ((HEAPU16[(l3) >> 1]) != 41) {break L39;}l1 = HEAP32[(0 + 1200) >> 2];if (l1 == 0) {break L39;}if ((HEAP32[(l1 + 4) >> 2]) != l3) {break L39;}l1 = HEAP32[(0 + 1204) >> 2];HEAP32[(0 + 1200) >> 2] = l1;HEAP32[(l1 ? (l1 + 36 | 0) : 1184) >> 2] = 0;}l4 = HEAPU16[(0 + 1260) >> 1];l1 = (HEAP32[(0 + 1284) >> 2]) + (l4 << 3) | 0;HEAP8[l1] = (HEAPU8[0 + 1292]) ? 6 : 2;t14 = f50(l3);l2 = t14;HEAP16[(0 + 1260) >> 1] = l4 + 1 | 0;HEAP8[l1 + 1] = l2;HEAP32[(l1 + 4) >> 2] = l3;HEAP8[0 + 1292] = 0;break L23;}l1 = HEAPU16[(0 + 1260) >> 1];if (l1 == 0) {break L16;}l1 = l1 + -1 | 0;HEAP16[(0 + 1260) >> 1] = l1;if ((HEAPU8[(HEAP32[(0 + 1284) >> 2]) + ((l1 & 65535) << 3) | 0]) == 4) {break L24;}break L23;}f60(39);break L23;}if (l5 != 34) {break L23;}f60(34);break L23;}L40: {L41: {l1 = HEAPU16[(l1 + 4) >> 1];if (l1 == 42) {break L41;}if (l1 != 47) {break L40;}f54();break L15;}f55(1);break L15;}L42: {L43: {t15 = f61();if (t15) {break L43;}l1 = 1;break L42;}f62();l1 = 0;}HEAP8[0 + 1280] = l1;break L23;}l1 = HEAPU16[(0 + 1260) >> 1];l4 = l1 << 3;l2 = (HEAP32[(0 + 1284) >> 2]) + l4 | 0;HEAP32[(l2 + 4) >> 2] = l3;HEAP16[(0 + 1260) >> 1] = l1 + 1 | 0;HEAP8[l2 + 1] = 0;HEAP8[(HEAP32[(0 + 1284) >> 2]) + l4 | 0] = 3;}f63();}L44: {if ((HEAPU8[0 + 1221]) == 0) {break L44;}f64(l5);}L45: {l4 = HEAP32[(0 + 1296) >> 2];t16 = f65(HEAPU16[(l4) >> 1]);if (t16 == 0) {break L45;}l1 = l4 + 2 | 0;l3 = HEAP32[(0 + 1300) >> 2];L46: while (1) {l4 = l1 + -2 | 0;if (l4 >>> 0 >= l3 >>> 0) {break L45;}t17 = f65(HEAPU16[(l1) >> 1]);if (t17 == 0) {break L45;}HEAP32[(0 + 1296) >> 2] = l1;l1 = l1 + 2 | 0;continue L46;}}HEAP32[(0 + 1264) >> 2] = l4;break L15;}l1 = HEAPU8[0 + 1223];L47: {L48: {L49: {if (l2 == (((HEAP32[(0 + 1180) >> 2]) + ((HEAP32[(0 + 1224) >> 2]) << 1) | 0) + -2 | 0)) {break L49;}if (l1 & 255) {break L49;}HEAP8[0 + 1232] = 1;break L48;}if ((HEAPU8[0 + 1232]) == 0) {break L47;}}f56();l3 = 0;break L1;}l3 = 0;if (HEAPU16[(0 + 1260) >> 1]) {break L1;}l3 = (((l1 & 255) | (HEAPU16[(0 + 1258) >> 1])) == 0) | 0;break L1;}f66();l3 = 0;break L1;}l1 = HEAP32[(0 + 1296) >> 2];continue L14;}}sp = l0 + 10240 | 0;return l3;}
+function f25(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 98) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 114) {break L0;}if ((HEAPU16[(l0 + 10) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 12) >> 1]) != 99) {break L0;}l1 = ((HEAPU16[(l0 + 14) >> 1]) == 116) | 0;}return l1;}
+function f26(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 114) {break L0;}l1 = ((HEAPU16[(l0 + 10) >> 1]) == 116) | 0;}return l1;}
+function f27(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 121) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 110) {break L0;}l1 = ((HEAPU16[(l0 + 8) >> 1]) == 99) | 0;}return l1;}
+function f28(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 99) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 108) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 115) {break L0;}l1 = ((HEAPU16[(l0 + 8) >> 1]) == 115) | 0;}return l1;}
+function f29(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 99) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 111) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 115) {break L0;}l1 = ((HEAPU16[(l0 + 8) >> 1]) == 116) | 0;}return l1;}
+function f30(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 100) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 99) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 108) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 10) >> 1]) != 114) {break L0;}l1 = ((HEAPU16[(l0 + 12) >> 1]) == 101) | 0;}return l1;}
+function f31(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 100) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 102) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 101) {break L0;}l1 = ((HEAPU16[(l0 + 8) >> 1]) == 114) | 0;}return l1;}
+function f32(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 117) {break L0;}l1 = ((HEAPU16[(l0 + 6) >> 1]) == 109) | 0;}return l1;}
+function f33(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 120) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 112) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 111) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 114) {break L0;}l1 = ((HEAPU16[(l0 + 10) >> 1]) == 116) | 0;}return l1;}
+function f34(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 102) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 114) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 111) {break L0;}l1 = ((HEAPU16[(l0 + 6) >> 1]) == 109) | 0;}return l1;}
+function f35(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 102) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 99) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + 10) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + 12) >> 1]) != 111) {break L0;}l1 = ((HEAPU16[(l0 + 14) >> 1]) == 110) | 0;}return l1;}
+function f36(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 109) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 112) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 111) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 114) {break L0;}l1 = ((HEAPU16[(l0 + 10) >> 1]) == 116) | 0;}return l1;}
+function f37(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 114) {break L0;}if ((HEAPU16[(l0 + 10) >> 1]) != 102) {break L0;}if ((HEAPU16[(l0 + 12) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 14) >> 1]) != 99) {break L0;}l1 = ((HEAPU16[(l0 + 16) >> 1]) == 101) | 0;}return l1;}
+function f38(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 109) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 116) {break L0;}l1 = ((HEAPU16[(l0 + 6) >> 1]) == 97) | 0;}return l1;}
+function f39(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 109) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 111) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 100) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 108) {break L0;}l1 = ((HEAPU16[(l0 + 10) >> 1]) == 101) | 0;}return l1;}
+function f40(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 109) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + 10) >> 1]) != 112) {break L0;}if ((HEAPU16[(l0 + 12) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + 14) >> 1]) != 99) {break L0;}l1 = ((HEAPU16[(l0 + 16) >> 1]) == 101) | 0;}return l1;}
+function f41(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 114) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 113) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + 10) >> 1]) != 114) {break L0;}l1 = ((HEAPU16[(l0 + 12) >> 1]) == 101) | 0;}return l1;}
+function f42(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 111) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + 6) >> 1]) != 114) {break L0;}if ((HEAPU16[(l0 + 8) >> 1]) != 99) {break L0;}l1 = ((HEAPU16[(l0 + 10) >> 1]) == 101) | 0;}return l1;}
+function f43(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 121) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 112) {break L0;}l1 = ((HEAPU16[(l0 + 6) >> 1]) == 101) | 0;}return l1;}
+function f44(l0){var l1 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 119) {break L0;}if ((HEAPU16[(l0 + 2) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + 4) >> 1]) != 116) {break L0;}l1 = ((HEAPU16[(l0 + 6) >> 1]) == 104) | 0;}return l1;}
+function f45(l0){var l1 = 0,l2 = 0,l3 = 0,l4 = 0,t0 = 0;l1 = 0;L0: {L1: {L2: {L3: {L4: {L5: {L6: {L7: {L8: {L9: {L10: {switch ((HEAPU16[(l0) >> 1]) + -100 | 0) {  case 0:break L10;  case 1:break L9;  case 2:break L8;  case 7:break L7;  case 10:break L6;  case 11:break L5;  case 14:break L4;  case 16:break L3;  case 19:break L2;  default:break L0;}}l1 = 0;l2 = l0 + -2 | 0;l3 = HEAP32[(0 + 1180) >> 2];if (l2 >>> 0 < l3 >>> 0) {break L0;}L11: {L12: {switch ((HEAPU16[(l2) >> 1]) + -105 | 0) {  case 0:break L12;  case 3:break L11;  default:break L0;}}l2 = l0 + -6 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 111) {break L0;}if ((HEAPU16[(l2) >> 1]) == 118) {break L1;}break L0;}l2 = l0 + -8 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l2) >> 1]) == 121) {break L1;}break L0;}l1 = 0;l2 = l0 + -2 | 0;l3 = HEAP32[(0 + 1180) >> 2];if (l2 >>> 0 < l3 >>> 0) {break L0;}L13: {L14: {L15: {switch ((HEAPU16[(l2) >> 1]) + -115 | 0) {  case 0:break L15;  case 1:break L14;  case 2:break L13;  default:break L0;}}l2 = l0 + -4 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}L16: {l2 = HEAPU16[(l2) >> 1];if (l2 == 108) {break L16;}if (l2 != 97) {break L0;}l2 = l0 + -6 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l2) >> 1]) == 99) {break L1;}break L0;}l2 = l0 + -6 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l2) >> 1]) == 101) {break L1;}break L0;}l2 = l0 + -10 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 108) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l2) >> 1]) == 100) {break L1;}break L0;}l2 = l0 + -14 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + -10 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + -12 | 0) >> 1]) != 111) {break L0;}if ((HEAPU16[(l2) >> 1]) == 99) {break L1;}break L0;}l1 = 0;l2 = l0 + -2 | 0;l3 = HEAP32[(0 + 1180) >> 2];if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l2) >> 1]) != 111) {break L0;}l2 = l0 + -4 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l2) >> 1]) != 101) {break L0;}l2 = l0 + -6 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}L17: {l2 = HEAPU16[(l2) >> 1];if (l2 == 112) {break L17;}if (l2 != 99) {break L0;}l2 = l0 + -18 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + -10 | 0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + -12 | 0) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + -14 | 0) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + -16 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l2) >> 1]) == 105) {break L1;}break L0;}l2 = l0 + -10 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 121) {break L0;}if ((HEAPU16[(l2) >> 1]) == 116) {break L1;}break L0;}l1 = 0;l2 = l0 + -8 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 114) {break L0;}if ((HEAPU16[(l2) >> 1]) == 98) {break L1;}break L0;}l1 = 0;l2 = l0 + -2 | 0;l3 = HEAP32[(0 + 1180) >> 2];if (l2 >>> 0 < l3 >>> 0) {break L0;}l4 = HEAPU16[(l2) >> 1];if (l4 == 105) {break L1;}if (l4 != 114) {break L0;}l2 = l0 + -10 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l2) >> 1]) == 114) {break L1;}break L0;}l1 = 0;l2 = l0 + -2 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l2) >> 1]) == 100) {break L1;}break L0;}l1 = 0;l2 = l0 + -14 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 103) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 103) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + -10 | 0) >> 1]) != 98) {break L0;}if ((HEAPU16[(l0 + -12 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l2) >> 1]) == 100) {break L1;}break L0;}l1 = 0;l2 = l0 + -8 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 119) {break L0;}if ((HEAPU16[(l2) >> 1]) == 97) {break L1;}break L0;}l1 = 0;l2 = l0 + -2 | 0;l3 = HEAP32[(0 + 1180) >> 2];if (l2 >>> 0 < l3 >>> 0) {break L0;}L18: {l2 = HEAPU16[(l2) >> 1];if (l2 == 111) {break L18;}if (l2 != 101) {break L0;}l2 = l0 + -4 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l2) >> 1]) == 110) {break L1;}break L0;}l2 = l0 + -8 | 0;if (l2 >>> 0 < l3 >>> 0) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 114) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 104) {break L0;}if ((HEAPU16[(l2) >> 1]) != 116) {break L0;}}t0 = f46(l2);l1 = t0;}return l1;}
+function f46(l0){var t0 = 0;L0: {if ((HEAP32[(0 + 1180) >> 2]) != l0) {break L0;}return 1;}t0 = f47(l0 + -2 | 0);return t0;}
+function f47(l0){var l1 = 0,t0 = 0,t1 = 0;l1 = 1;L0: {t0 = f58(HEAPU16[(l0) >> 1]);if (t0) {break L0;}t1 = f69(l0);l1 = t1;}return l1;}
+function f48(l0){var l1 = 0,l2 = 0,t0 = 0;L0: {L1: {L2: {l1 = HEAPU16[(l0) >> 1];if (l1 == 107) {break L2;}l2 = 0;if (l1 != 101) {break L0;}l2 = 0;l1 = l0 + -14 | 0;if (l1 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 117) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + -10 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + -12 | 0) >> 1]) != 111) {break L0;}if ((HEAPU16[(l1) >> 1]) == 99) {break L1;}break L0;}l2 = 0;l1 = l0 + -8 | 0;if (l1 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 101) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 114) {break L0;}if ((HEAPU16[(l1) >> 1]) != 98) {break L0;}}t0 = f46(l1);l2 = t0;}return l2;}
+function f49(l0){var l1 = 0,l2 = 0,t0 = 0,t1 = 0,t2 = 0;L0: {L1: {L2: {L3: {l1 = HEAPU16[(l0) >> 1];switch (l1 + -101 | 0) {  case 0:break L3;  case 1:break L2;  default:break L1;}}l2 = 0;l1 = l0 + -8 | 0;if (l1 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 108) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 105) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 104) {break L0;}if ((HEAPU16[(l1) >> 1]) != 119) {break L0;}t0 = f46(l1);return t0 ? 3 : 0;}l2 = 0;l0 = l0 + -2 | 0;if (l0 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0) >> 1]) != 105) {break L0;}t1 = f46(l0);return t1;}l2 = 0;if (l1 != 114) {break L0;}l2 = 0;l1 = l0 + -4 | 0;if (l1 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 111) {break L0;}if ((HEAPU16[(l1) >> 1]) != 102) {break L0;}t2 = f46(l1);l2 = t2 ? 2 : 0;}return l2;}
+function f50(l0){var l1 = 0,l2 = 0,t0 = 0;l1 = 0;L0: {L1: {L2: {L3: {L4: {l2 = HEAPU16[(l0) >> 1];switch (l2 + -101 | 0) {  case 0:break L4;  case 1: case 2:break L0;  case 3:break L3;  default:break L2;}}l1 = 0;l2 = l0 + -6 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 115) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 108) {break L0;}l0 = 6;if ((HEAPU16[(l2) >> 1]) == 101) {break L1;}break L0;}l1 = 0;l2 = l0 + -8 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 99) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 116) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 97) {break L0;}l0 = 4;if ((HEAPU16[(l2) >> 1]) == 99) {break L1;}break L0;}if (l2 != 121) {break L0;}l1 = 0;l2 = l0 + -12 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 108) {break L0;}if ((HEAPU16[(l0 + -4 | 0) >> 1]) != 108) {break L0;}if ((HEAPU16[(l0 + -6 | 0) >> 1]) != 97) {break L0;}if ((HEAPU16[(l0 + -8 | 0) >> 1]) != 110) {break L0;}if ((HEAPU16[(l0 + -10 | 0) >> 1]) != 105) {break L0;}l0 = 5;if ((HEAPU16[(l2) >> 1]) != 102) {break L0;}}t0 = f46(l2);l1 = t0 ? l0 : 0;}return l1;}
+function f51(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0,l4 = 0,l5 = 0,l6 = 0,l7 = 0,l8 = 0,t0 = 0,t1 = 0,t2 = 0,t3 = 0,t4 = 0,t5 = 0,t6 = 0,t7 = 0,t8 = 0,t9 = 0,t10 = 0,t11 = 0,t12 = 0,t13 = 0,t14 = 0,t15 = 0,t16 = 0,t17 = 0,t18 = 0,t19 = 0,t20 = 0,t21 = 0,t22 = 0,t23 = 0,t24 = 0,t25 = 0,t26 = 0,t27 = 0,t28 = 0,t29 = 0,t30 = 0,t31 = 0,t32 = 0,t33 = 0,t34 = 0,t35 = 0,t36 = 0,t37 = 0,t38 = 0,t39 = 0,t40 = 0,t41 = 0,t42 = 0,t43 = 0,t44 = 0,t45 = 0,t46 = 0,t47 = 0,t48 = 0,t49 = 0,t50 = 0,t51 = 0,t52 = 0,t53 = 0,t54 = 0,t55 = 0,t56 = 0,t57 = 0,t58 = 0,t59 = 0,t60 = 0,t61 = 0,t62 = 0,t63 = 0,t64 = 0,t65 = 0,t66 = 0,t67 = 0,t68 = 0,t69 = 0,t70 = 0,t71 = 0,t72 = 0;l0 = HEAP32[(0 + 1296) >> 2];l1 = l0 + 12 | 0;HEAP32[(0 + 1296) >> 2] = l1;HEAP8[0 + 1222] = 0;l2 = HEAP32[(0 + 1208) >> 2];t0 = f68(1);l3 = t0;L0: {L1: {L2: {l4 = HEAP32[(0 + 1296) >> 2];if (l4 != l1) {break L2;}if (l3 >>> 0 > 127 >>> 0) {break L1;}if (((HEAPU8[l3 + 1040 | 0]) & 4) == 0) {break L1;}}L3: {L4: {L5: {L6: {L7: {L8: {if (HEAPU8[0 + 1221]) {break L8;}l1 = l4;break L7;}L9: {t1 = f30(l4);if (t1 == 0) {break L9;}l1 = l4 + 14 | 0;t2 = f59(HEAPU16[(l4 + 14) >> 1]);if (t2 == 0) {break L9;}HEAP32[(0 + 1296) >> 2] = l1;t3 = f68(1);l3 = t3;HEAP8[0 + 1222] = 1;l4 = HEAP32[(0 + 1296) >> 2];}L10: {t4 = f25(l4);if (t4 == 0) {break L10;}l1 = l4 + 16 | 0;t5 = f59(HEAPU16[(l4 + 16) >> 1]);if (t5 == 0) {break L10;}HEAP32[(0 + 1296) >> 2] = l1;t6 = f68(1);l3 = t6;l4 = HEAP32[(0 + 1296) >> 2];}L11: {t7 = f43(l4);if (t7 == 0) {break L11;}l1 = l4 + 8 | 0;t8 = f65(HEAPU16[(l4 + 8) >> 1]);if (t8) {break L11;}HEAP32[(0 + 1296) >> 2] = l1;L12: {L13: {t9 = f68(1);l3 = t9;if (l3 == 123) {break L13;}if (l3 != 42) {break L12;}}HEAP8[0 + 1222] = 1;l4 = HEAP32[(0 + 1296) >> 2];break L11;}L14: {if ((HEAP32[(0 + 1296) >> 2]) >>> 0 <= l1 >>> 0) {break L14;}t10 = f65(l3);if (t10) {break L6;}}HEAP32[(0 + 1296) >> 2] = l4;l3 = HEAPU16[(l4) >> 1];}L15: {t11 = f37(l4);if (t11 == 0) {break L15;}l1 = l4 + 18 | 0;t12 = f59(HEAPU16[(l4 + 18) >> 1]);if (t12 == 0) {break L15;}HEAP8[0 + 1222] = 1;HEAP32[(0 + 1296) >> 2] = l1;t13 = f68(1);f73(t13);return;}L16: {L17: {t14 = f29(l4);if (t14 == 0) {break L17;}l1 = l4 + 10 | 0;t15 = f59(HEAPU16[(l4 + 10) >> 1]);if (t15 == 0) {break L17;}HEAP32[(0 + 1296) >> 2] = l1;t16 = f68(1);L18: {l1 = HEAP32[(0 + 1296) >> 2];t17 = f32(l1);if (t17 == 0) {break L18;}t18 = f59(HEAPU16[(l1 + 8) >> 1]);if (t18) {break L16;}}HEAP32[(0 + 1296) >> 2] = l4;l3 = HEAPU16[(l4) >> 1];}l1 = l4;}L19: {t19 = f32(l1);if (t19 == 0) {break L19;}l4 = l1 + 8 | 0;t20 = f59(HEAPU16[(l1 + 8) >> 1]);if (t20 == 0) {break L19;}HEAP32[(0 + 1296) >> 2] = l4;t21 = f68(1);f73(t21);return;}L20: {t22 = f40(l1);if (t22 == 0) {break L20;}l4 = l1 + 18 | 0;t23 = f59(HEAPU16[(l1 + 18) >> 1]);if (t23 == 0) {break L20;}HEAP32[(0 + 1296) >> 2] = l4;t24 = f68(1);f73(t24);return;}L21: {t25 = f39(l1);if (t25 == 0) {break L21;}l4 = l1 + 12 | 0;t26 = f59(HEAPU16[(l1 + 12) >> 1]);if (t26 == 0) {break L21;}HEAP32[(0 + 1296) >> 2] = l4;t27 = f68(1);f73(t27);return;}if ((HEAPU16[(l1) >> 1]) != 97) {break L7;}if ((HEAPU16[(l1 + 2) >> 1]) != 115) {break L7;}t28 = f59(HEAPU16[(l1 + 4) >> 1]);if (t28) {break L1;}}l4 = l3 & 65535;if (l4 == 42) {break L4;}if (l4 != 123) {break L5;}HEAP32[(0 + 1296) >> 2] = l1 + 2 | 0;l5 = HEAPU8[0 + 1222];t29 = f68(1);l4 = t29;l1 = HEAP32[(0 + 1296) >> 2];l6 = ((l5 & 255) != 0) | 0;l7 = 1;l8 = 0;L22: while (1) {L23: {L24: {if ((HEAPU8[0 + 1221]) == 0) {break L24;}l3 = l4 & 65535;if (l3 == 125) {break L24;}if (l3 == 44) {break L24;}t30 = f72();l8 = t30;HEAP32[(0 + 1296) >> 2] = l1;L25: {L26: {if (l8) {break L26;}l3 = l1;break L25;}HEAP32[(0 + 1296) >> 2] = l1 + 8 | 0;t31 = f68(1);l4 = t31;l3 = HEAP32[(0 + 1296) >> 2];}HEAP8[0 + 1222] = l6 | l8;l7 = l7 & l8;l8 = 1;break L23;}l3 = l1;}L27: {L28: {l4 = l4 & 65535;if (l4 == 34) {break L28;}if (l4 == 39) {break L28;}t32 = f70(l4);l4 = HEAP32[(0 + 1296) >> 2];break L27;}f60(l4);l4 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP32[(0 + 1296) >> 2] = l4;}t33 = f68(1);L29: {t34 = f74(l3, l4);l4 = t34;if (l4 != 44) {break L29;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t35 = f68(1);l4 = t35;}L30: {if (l4 == 125) {break L30;}l1 = HEAP32[(0 + 1296) >> 2];if (l1 == l3) {break L0;}if (l1 >>> 0 <= (HEAP32[(0 + 1300) >> 2]) >>> 0) {continue L22;}break L0;}break L22;}HEAP8[0 + 1248] = 1;HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP8[0 + 1222] = ((((l5 & 255) != 0) | 0) | (l8 & l7)) & 1;break L3;}HEAP8[0 + 1222] = 1;f73(l3);return;}HEAP8[0 + 1256] = 0;L31: {L32: {L33: {L34: {L35: {L36: {L37: {l4 = l3 & 65535;switch (l4 + -97 | 0) {  case 0:break L35;  case 1: case 4: case 6: case 7: case 8: case 9: case 10:break L1;  case 2:break L33;  case 3:break L36;  case 5:break L34;  case 11:break L32;  default:break L37;}}if (l4 == 118) {break L32;}break L1;}l3 = l1 + 14 | 0;HEAP32[(0 + 1296) >> 2] = l3;t36 = f68(1);l4 = t36;L38: {if ((HEAPU8[0 + 1221]) == 0) {break L38;}l8 = HEAP32[(0 + 1296) >> 2];t37 = f25(l8);if (t37 == 0) {break L38;}l7 = l8 + 16 | 0;t38 = f59(HEAPU16[(l8 + 16) >> 1]);if (t38 == 0) {break L38;}HEAP32[(0 + 1296) >> 2] = l7;t39 = f68(1);l4 = t39;}L39: {L40: {L41: {L42: {L43: {switch (l4 + -97 | 0) {  case 0:break L43;  case 2:break L41;  case 5:break L42;  case 8:break L40;  default:break L31;}}l4 = HEAP32[(0 + 1296) >> 2];t40 = f27(l4);if (t40 == 0) {break L31;}l8 = l4 + 10 | 0;t41 = f67(HEAPU16[(l4 + 10) >> 1]);if (t41 == 0) {break L31;}HEAP32[(0 + 1296) >> 2] = l8;t42 = f68(0);}l4 = HEAP32[(0 + 1296) >> 2];t43 = f35(l4);if (t43 == 0) {break L31;}l8 = l4 + 16 | 0;L44: {l4 = HEAPU16[(l4 + 16) >> 1];t44 = f59(l4);if (t44) {break L44;}switch (l4 + -40 | 0) {  case 0: case 2:break L44;  default:break L31;}}HEAP32[(0 + 1296) >> 2] = l8;L45: {t45 = f68(1);l4 = t45;if (l4 != 42) {break L45;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t46 = f68(1);l4 = t46;}if (l4 == 40) {break L31;}break L39;}l4 = HEAP32[(0 + 1296) >> 2];t47 = f28(l4);if (t47 == 0) {break L31;}l8 = l4 + 10 | 0;L46: {l4 = HEAPU16[(l4 + 10) >> 1];t48 = f59(l4);if (t48) {break L46;}if (l4 != 123) {break L31;}}HEAP32[(0 + 1296) >> 2] = l8;t49 = f68(1);l4 = t49;if (l4 != 123) {break L39;}break L31;}if ((HEAPU8[0 + 1221]) == 0) {break L31;}l4 = HEAP32[(0 + 1296) >> 2];t50 = f37(l4);if (t50 == 0) {break L31;}l8 = l4 + 18 | 0;t51 = f59(HEAPU16[(l4 + 18) >> 1]);if (t51 == 0) {break L31;}HEAP32[(0 + 1296) >> 2] = l8;t52 = f68(1);l4 = t52;HEAP8[0 + 1222] = 1;}l8 = HEAP32[(0 + 1296) >> 2];t53 = f70(l4);l4 = HEAP32[(0 + 1296) >> 2];if (l4 >>> 0 <= l8 >>> 0) {break L31;}f3(l1, l3, l8, l4);HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;return;}HEAP32[(0 + 1296) >> 2] = l1 + 10 | 0;t54 = f68(0);l1 = HEAP32[(0 + 1296) >> 2];}HEAP32[(0 + 1296) >> 2] = l1 + 16 | 0;L47: {t55 = f68(1);l1 = t55;if (l1 != 42) {break L47;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t56 = f68(1);l1 = t56;}l4 = HEAP32[(0 + 1296) >> 2];t57 = f70(l1);l1 = HEAP32[(0 + 1296) >> 2];f3(l4, l1, l4, l1);HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;return;}L48: {t58 = f28(l1);if (t58 == 0) {break L48;}l4 = l1 + 10 | 0;t59 = f58(HEAPU16[(l1 + 10) >> 1]);if (t59 == 0) {break L48;}HEAP32[(0 + 1296) >> 2] = l4;t60 = f68(1);l1 = t60;l4 = HEAP32[(0 + 1296) >> 2];t61 = f70(l1);l1 = HEAP32[(0 + 1296) >> 2];f3(l4, l1, l4, l1);HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;return;}l1 = l1 + 4 | 0;}HEAP32[(0 + 1296) >> 2] = l1 + 6 | 0;HEAP8[0 + 1256] = 0;t62 = f68(1);l1 = t62;l4 = HEAP32[(0 + 1296) >> 2];t63 = f70(l1);l1 = t63;l7 = HEAP32[(0 + 1296) >> 2];L49: {L50: {l3 = l1 & 65503;if (l3 != 91) {break L50;}HEAP32[(0 + 1296) >> 2] = l7 + 2 | 0;t64 = f68(1);l8 = t64;l4 = HEAP32[(0 + 1296) >> 2];l1 = 0;break L49;}l1 = 1;}L51: while (1) {L52: {L53: {switch (l1) {  case 0:break L53;  default:break L52;}}t65 = f70(l8 & 65535);l1 = 1;continue L51;}L54: {L55: {l1 = HEAP32[(0 + 1296) >> 2];if (l1 == l4) {break L55;}f3(l4, l1, l4, l1);t66 = f68(1);l1 = t66;l4 = l1 & 65503;L56: {if (l3 != 91) {break L56;}if (l4 == 93) {break L1;}}l4 = HEAP32[(0 + 1296) >> 2];L57: {if (l1 != 44) {break L57;}HEAP32[(0 + 1296) >> 2] = l4 + 2 | 0;t67 = f68(1);l8 = t67;l4 = HEAP32[(0 + 1296) >> 2];if ((l8 & 65503) != 91) {break L54;}}l4 = l4 + -2 | 0;HEAP32[(0 + 1296) >> 2] = l4;}if (l3 != 91) {break L1;}L58: {l1 = HEAP32[(0 + 1300) >> 2];if (l4 >>> 0 < l1 >>> 0) {break L58;}if (l1 == (((HEAP32[(0 + 1180) >> 2]) + ((HEAP32[(0 + 1224) >> 2]) << 1) | 0) + -2 | 0)) {break L58;}HEAP8[0 + 1232] = 1;}HEAP32[(0 + 1296) >> 2] = l7 + -2 | 0;return;}l1 = 0;continue L51;}}f3(l1, l3, 0, 0);HEAP32[(0 + 1296) >> 2] = l1 + 12 | 0;return;}HEAP32[(0 + 1296) >> 2] = l1 + 2 | 0;t68 = f68(1);l4 = HEAP32[(0 + 1296) >> 2];t69 = f74(l4, l4);}t70 = f68(1);L59: {l4 = HEAP32[(0 + 1296) >> 2];t71 = f34(l4);if (t71 == 0) {break L59;}HEAP32[(0 + 1296) >> 2] = l4 + 8 | 0;t72 = f68(1);f71(l0, t72, 0);l4 = l2 ? (l2 + 20 | 0) : 1188;L60: while (1) {l4 = HEAP32[(l4) >> 2];if (l4 == 0) {break L1;}st64a2(l4 + 8, 0n);l4 = l4 + 20 | 0;continue L60;}}HEAP32[(0 + 1296) >> 2] = l4 + -2 | 0;}return;}f66();}
+function f52(l0){var l1 = 0,l2 = 0;L0: {if (HEAP32[(0 + 1236) >> 2]) {break L0;}L1: {l1 = HEAP32[(0 + 1300) >> 2];if ((HEAP32[(0 + 1296) >> 2]) >>> 0 >= l1 >>> 0) {break L1;}if ((HEAPU8[0 + 1232]) & 255) {break L1;}L2: {l2 = HEAP32[(0 + 1200) >> 2];if (l2 == 0) {break L2;}if ((HEAP32[(l2 + 4) >> 2]) >>> 0 > (l1 + 2 | 0) >>> 0) {break L1;}}l2 = HEAP32[(0 + 1208) >> 2];if (l2 == 0) {break L0;}if ((HEAP32[(l2 + 4) >> 2]) >>> 0 <= (l1 + 2 | 0) >>> 0) {break L0;}}HEAP32[(0 + 1236) >> 2] = l0;}}
+function f53(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0,l4 = 0,l5 = 0,l6 = 0,l7 = 0,l8 = 0,l9 = 0,t0 = 0,t1 = 0,t2 = 0,t3 = 0,t4 = 0,t5 = 0,t6 = 0,t7 = 0,t8 = 0,t9 = 0,t10 = 0,t11 = 0,t12 = 0,t13 = 0,t14 = 0,t15 = 0,t16 = 0,t17 = 0,t18 = 0,t19 = 0,t20 = 0,t21 = 0,t22 = 0,t23 = 0,t24 = 0,t25 = 0,t26 = 0,t27 = 0,t28 = 0,t29 = 0,t30 = 0,t31 = 0,t32 = 0,t33 = 0,t34 = 0,t35 = 0,t36 = 0,t37 = 0,t38 = 0,t39 = 0,t40 = 0,t41 = 0,t42 = 0;l0 = HEAP32[(0 + 1296) >> 2];l1 = l0 + 12 | 0;HEAP32[(0 + 1296) >> 2] = l1;HEAP8[0 + 1222] = 0;t0 = f68(1);l2 = t0;l3 = HEAP32[(0 + 1296) >> 2];L0: {L1: {L2: {L3: {L4: {L5: {L6: {L7: {L8: {L9: {if (l2 != 46) {break L9;}HEAP32[(0 + 1296) >> 2] = l3 + 2 | 0;t1 = f68(1);L10: {l3 = HEAP32[(0 + 1296) >> 2];t2 = f38(l3);if (t2 == 0) {break L10;}L11: {l2 = HEAP32[(0 + 1264) >> 2];t3 = f69(l2);if (t3) {break L11;}if ((HEAPU16[(l2) >> 1]) == 46) {break L10;}}f2(l0, l0, l3 + 8 | 0, HEAP32[(0 + 1172) >> 2]);return;}L12: {t4 = f42(l3);if (t4 == 0) {break L12;}l4 = 0;L13: {l2 = HEAP32[(0 + 1264) >> 2];t5 = f69(l2);if (t5) {break L13;}if ((HEAPU16[(l2) >> 1]) == 46) {break L12;}}HEAP32[(0 + 1296) >> 2] = l3 + 12 | 0;l5 = 1;l6 = 5;t6 = f68(1);l2 = t6;break L8;}t7 = f31(l3);if (t7 == 0) {break L5;}l4 = 0;L14: {l2 = HEAP32[(0 + 1264) >> 2];t8 = f69(l2);if (t8) {break L14;}if ((HEAPU16[(l2) >> 1]) == 46) {break L5;}}HEAP32[(0 + 1296) >> 2] = l3 + 10 | 0;l7 = 2;l6 = 7;l8 = 1;t9 = f68(1);l2 = t9;l5 = 0;break L7;}L15: {L16: {L17: {l5 = (l3 >>> 0 <= l1 >>> 0) | 0;if (l5) {break L17;}t10 = f42(l3);if (t10 == 0) {break L17;}t11 = f59(HEAPU16[(l3 + 12) >> 1]);if (t11 == 0) {break L17;}l4 = 0;l8 = l3 + 12 | 0;HEAP32[(0 + 1296) >> 2] = l8;l5 = 1;t12 = f68(1);l2 = t12;L18: {l7 = HEAP32[(0 + 1296) >> 2];if (l7 == l8) {break L18;}l6 = 5;t13 = f34(l7);if (t13 == 0) {break L8;}l5 = 1;t14 = f58(HEAPU16[(l7 + 8) >> 1]);if (t14 == 0) {break L8;}}l8 = 0;HEAP32[(0 + 1296) >> 2] = l3;l6 = 7;break L16;}L19: {if (l3 >>> 0 <= (l0 + 10 | 0) >>> 0) {break L19;}t15 = f31(l3);if (t15 == 0) {break L19;}t16 = f59(HEAPU16[(l3 + 10) >> 1]);if (t16 == 0) {break L19;}l5 = 0;HEAP32[(0 + 1296) >> 2] = l3 + 10 | 0;l2 = 42;l4 = 1;l7 = 2;t17 = f68(1);l9 = t17;if (l9 == 42) {break L6;}l8 = 0;HEAP32[(0 + 1296) >> 2] = l3;l6 = 7;l5 = 1;l7 = 0;l2 = l9;break L7;}l8 = 0;l6 = 7;l4 = 1;if ((HEAPU8[0 + 1221]) == 0) {break L15;}l8 = 0;if (l5) {break L15;}l8 = 0;t18 = f43(l3);if (t18 == 0) {break L15;}l8 = 0;t19 = f65(HEAPU16[(l3 + 8) >> 1]);if (t19) {break L15;}HEAP32[(0 + 1296) >> 2] = l3 + 8 | 0;L20: {L21: {t20 = f68(1);l2 = t20;if (l2 == 42) {break L21;}if (l2 == 123) {break L21;}t21 = f65(l2);if (t21 == 0) {break L20;}}L22: {l8 = HEAP32[(0 + 1296) >> 2];t22 = f34(l8);if (t22 == 0) {break L22;}t23 = f65(HEAPU16[(l8 + 8) >> 1]);if (t23) {break L22;}HEAP32[(0 + 1296) >> 2] = l8 + 8 | 0;t24 = f68(1);l4 = t24;HEAP32[(0 + 1296) >> 2] = l8;if (l4 == 34) {break L20;}if (l4 == 39) {break L20;}}l4 = 1;l8 = 0;HEAP8[0 + 1222] = 1;break L15;}l8 = 0;HEAP32[(0 + 1296) >> 2] = l3;l2 = HEAPU16[(l3) >> 1];}l4 = 1;}l5 = 1;l7 = 0;break L7;}l8 = 1;l7 = 1;}L23: {l3 = l2 & 65535;if (l3 != 40) {break L23;}l3 = HEAPU16[(0 + 1260) >> 1];l2 = (HEAP32[(0 + 1284) >> 2]) + (l3 << 3) | 0;HEAP32[(l2 + 4) >> 2] = HEAP32[(0 + 1296) >> 2];HEAP16[(0 + 1260) >> 1] = l3 + 1 | 0;HEAP16[(l2) >> 1] = 5;if ((HEAPU16[(HEAP32[(0 + 1264) >> 2]) >> 1]) == 46) {break L5;}l2 = HEAP32[(0 + 1296) >> 2];HEAP32[(0 + 1296) >> 2] = l2 + 2 | 0;t25 = f68(1);l3 = t25;f2(l0, HEAP32[(0 + 1296) >> 2], 0, l2);l2 = HEAP32[(0 + 1200) >> 2];L24: {if (l8 == 0) {break L24;}HEAP32[(l2 + 28) >> 2] = l6;}l0 = HEAPU16[(0 + 1258) >> 1];HEAP16[(0 + 1258) >> 1] = l0 + 1 | 0;HEAP32[((HEAP32[(0 + 1288) >> 2]) + (l0 << 2) | 0) >> 2] = l2;L25: {if (l3 != 39) {break L25;}l2 = l3;break L0;}l2 = 34;if (l3 == 34) {break L0;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;return;}L26: {if ((l4 ^ 1) | ((l3 != 123) | 0)) {break L26;}L27: {if ((HEAPU16[(0 + 1260) >> 1]) == 0) {break L27;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;return;}l3 = HEAP32[(0 + 1296) >> 2];if (HEAPU8[0 + 1221]) {break L3;}L28: while (1) {if (l3 >>> 0 >= (HEAP32[(0 + 1300) >> 2]) >>> 0) {break L2;}L29: {L30: {t26 = f68(1);l3 = t26;if (l3 == 34) {break L30;}if (l3 == 39) {break L30;}if (l3 != 125) {break L29;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;break L2;}f60(l3);}l3 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP32[(0 + 1296) >> 2] = l3;continue L28;}}L31: {L32: {l3 = l2 & 65535;switch (l3 + -39 | 0) {  case 0: case 3:break L6;  case 1: case 2:break L31;  default:break L32;}}if (l3 == 34) {break L6;}}if ((HEAP32[(0 + 1296) >> 2]) != l1) {break L6;}HEAP32[(0 + 1296) >> 2] = l0 + 10 | 0;return;}L33: {if ((l5 | (((l2 & 65535) == 42) | 0)) != 1) {break L33;}if (((HEAPU16[(0 + 1260) >> 1]) & 65535) == 0) {break L4;}}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;}return;}L34: {if ((HEAPU8[0 + 1221]) == 0) {break L34;}l3 = l2 & 65535;t27 = f65(l3);if (t27 == 0) {break L34;}l2 = HEAP32[(0 + 1296) >> 2];t28 = f70(l3);L35: {t29 = f68(1);if (t29 != 61) {break L35;}l3 = HEAP32[(0 + 1296) >> 2];HEAP32[(0 + 1296) >> 2] = l3 + 2 | 0;t30 = f68(1);L36: {l2 = HEAP32[(0 + 1296) >> 2];t31 = f41(l2);if (t31 == 0) {break L36;}t32 = f65(HEAPU16[(l2 + 14) >> 1]);if (t32) {break L36;}HEAP32[(0 + 1296) >> 2] = l2 + 14 | 0;t33 = f68(1);if (t33 != 40) {break L36;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;L37: {t34 = f68(1);l2 = t34;if (l2 == 39) {break L37;}if (l2 != 34) {break L36;}}l1 = HEAP32[(0 + 1296) >> 2];f60(l2);l2 = HEAP32[(0 + 1296) >> 2];HEAP32[(0 + 1296) >> 2] = l2 + 2 | 0;t35 = f68(1);if (t35 != 41) {break L36;}f2(l0, l1 + 2 | 0, l2, HEAP32[(0 + 1168) >> 2]);HEAP32[((HEAP32[(0 + 1200) >> 2]) + 12) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;return;}HEAP32[(0 + 1296) >> 2] = l3;return;}HEAP32[(0 + 1296) >> 2] = l2;}l3 = HEAP32[(0 + 1296) >> 2];l1 = HEAP32[(0 + 1300) >> 2];L38: while (1) {if (l3 >>> 0 >= l1 >>> 0) {break L1;}L39: {L40: {l2 = HEAPU16[(l3) >> 1];if (l2 == 39) {break L40;}if (l2 != 34) {break L39;}}f71(l0, l2, l7);return;}l3 = l3 + 2 | 0;HEAP32[(0 + 1296) >> 2] = l3;continue L38;}}l3 = l3 + 2 | 0;HEAP32[(0 + 1296) >> 2] = l3;l2 = 0;l1 = 1;L41: while (1) {L42: {L43: {L44: {if (l3 >>> 0 >= (HEAP32[(0 + 1300) >> 2]) >>> 0) {break L44;}t36 = f68(1);l3 = t36;if (l3 == 44) {break L43;}if (l3 != 125) {break L42;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;}HEAP8[0 + 1222] = ((((HEAPU8[0 + 1222]) != 0) | 0) | l2) & 1;break L2;}l3 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP32[(0 + 1296) >> 2] = l3;continue L41;}t37 = f72();l2 = t37;l3 = HEAP32[(0 + 1296) >> 2];l2 = l2 & l1;l1 = l2;continue L41;}}t38 = f68(1);l2 = t38;l3 = HEAP32[(0 + 1296) >> 2];L45: {if (l2 != 102) {break L45;}t39 = f34(l3);if (t39 == 0) {break L1;}}l3 = l3 + 8 | 0;HEAP32[(0 + 1296) >> 2] = l3;if (l3 >>> 0 > (HEAP32[(0 + 1300) >> 2]) >>> 0) {break L1;}L46: {t40 = f68(1);l3 = t40;if (l3 == 34) {break L46;}if (l3 != 39) {break L1;}}f71(l0, l3, 0);return;}f66();return;}f60(l2);l3 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP32[(0 + 1296) >> 2] = l3;L47: {L48: {L49: {t41 = f68(1);switch (t41 + -41 | 0) {  case 0:break L48;  case 3:break L49;  default:break L47;}}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t42 = f68(1);l2 = HEAP32[(0 + 1200) >> 2];HEAP32[(l2 + 4) >> 2] = l3;HEAP8[l2 + 24] = 1;l3 = HEAP32[(0 + 1296) >> 2];HEAP32[(l2 + 16) >> 2] = l3;HEAP32[(0 + 1296) >> 2] = l3 + -2 | 0;return;}l2 = HEAP32[(0 + 1200) >> 2];HEAP32[(l2 + 4) >> 2] = l3;HEAP8[l2 + 24] = 1;HEAP16[(0 + 1260) >> 1] = (HEAPU16[(0 + 1260) >> 1]) + -1 | 0;HEAP32[(l2 + 12) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP16[(0 + 1258) >> 1] = (HEAPU16[(0 + 1258) >> 1]) + -1 | 0;return;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;}
+function f54(){var l0 = 0,l1 = 0,l2 = 0;l0 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;l1 = HEAP32[(0 + 1300) >> 2];L0: {L1: while (1) {l2 = l0;if ((l2 + -2 | 0) >>> 0 >= l1 >>> 0) {break L0;}l0 = l2 + 2 | 0;switch ((HEAPU16[(l2) >> 1]) + -10 | 0) {  case 0: case 3:break L0;  default:continue L1;}}}HEAP32[(0 + 1296) >> 2] = l2;}
+function f55(l0){var l1 = 0,l2 = 0,l3 = 0;l1 = (HEAP32[(0 + 1296) >> 2]) + 6 | 0;l2 = HEAP32[(0 + 1300) >> 2];L0: {L1: {L2: while (1) {if ((l1 + -4 | 0) >>> 0 >= l2 >>> 0) {break L1;}l3 = HEAPU16[(l1 + -2 | 0) >> 1];L3: {L4: {L5: {if (l0) {break L5;}if (l3 == 42) {break L4;}switch (l3 + -10 | 0) {  case 0: case 3:break L1;  default:break L3;}}if (l3 != 42) {break L3;}}if ((HEAPU16[(l1) >> 1]) == 47) {break L0;}}l1 = l1 + 2 | 0;continue L2;}}l1 = l1 + -2 | 0;}HEAP32[(0 + 1296) >> 2] = l1;}
+function f56(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0;l0 = HEAP32[(0 + 1236) >> 2];l1 = l0 ? l0 : ((HEAP32[(0 + 1300) >> 2]) + 2 | 0);L0: {if ((HEAPU16[(0 + 1258) >> 1]) == 0) {break L0;}l0 = HEAP32[((HEAP32[(HEAP32[(0 + 1288) >> 2]) >> 2]) + 8) >> 2];l1 = (l0 >>> 0 < l1 >>> 0) ? l0 : l1;}L1: {l0 = HEAP32[(0 + 1200) >> 2];if (l0 == 0) {break L1;}l2 = HEAP32[(l0 + 20) >> 2];if (l2 == (HEAP32[(0 + 1168) >> 2])) {break L1;}if (l2 == (HEAP32[(0 + 1172) >> 2])) {break L1;}if ((HEAP32[(l0 + 12) >> 2]) != ((HEAP32[(0 + 1264) >> 2]) + 2 | 0)) {break L1;}l0 = HEAP32[(l0 + 8) >> 2];l1 = (l0 >>> 0 < l1 >>> 0) ? l0 : l1;}l0 = 0;l2 = 1184;L2: {L3: while (1) {l3 = l0;l0 = HEAP32[(l2) >> 2];if (l0 == 0) {break L2;}l2 = l0 + 36 | 0;if ((HEAP32[(l0 + 8) >> 2]) >>> 0 < l1 >>> 0) {continue L3;}break L3;}}l0 = 0;HEAP32[(l3 ? (l3 + 36 | 0) : 1184) >> 2] = 0;l2 = 1188;L4: {L5: while (1) {l3 = l0;l0 = HEAP32[(l2) >> 2];if (l0 == 0) {break L4;}l2 = l0 + 20 | 0;if ((HEAP32[(l0) >> 2]) >>> 0 < l1 >>> 0) {continue L5;}break L5;}}HEAP32[(l3 ? (l3 + 20 | 0) : 1188) >> 2] = 0;}
+function f57(l0){var l1 = 0,l2 = 0,l3 = 0,t0 = 0,t1 = 0,t2 = 0;l1 = 0;L0: {l2 = HEAP32[(0 + 1264) >> 2];t0 = f48(l2);if (t0 == 0) {break L0;}l3 = HEAPU16[(l0) >> 1];t1 = f58(l3);if (t1) {break L0;}if (l3 == 34) {break L0;}if (l3 == 39) {break L0;}if (l3 == 96) {break L0;}l2 = l2 + 2 | 0;L1: while (1) {l1 = (l2 >>> 0 >= l0 >>> 0) | 0;if (l1) {break L0;}l3 = HEAPU16[(l2) >> 1];l2 = l2 + 2 | 0;t2 = f67(l3);if (t2) {continue L1;}break L1;}}return l1;}
+function f58(l0){L0: {L1: {if (l0 >>> 0 > 127 >>> 0) {break L1;}l0 = (HEAPU8[l0 + 1040 | 0]) & 8;break L0;}l0 = (l0 == 160) | 0;}return (l0 != 0) | 0;}
+function f59(l0){L0: {L1: {if (l0 >>> 0 > 127 >>> 0) {break L1;}l0 = (HEAPU8[l0 + 1040 | 0]) & 2;break L0;}l0 = (l0 == 160) | 0;}return (l0 != 0) | 0;}
+function f60(l0){var l1 = 0,l2 = 0,l3 = 0,l4 = 0;l1 = HEAP32[(0 + 1296) >> 2];l2 = HEAP32[(0 + 1300) >> 2];L0: {L1: {L2: while (1) {l3 = l1;l1 = l3 + 2 | 0;if (l3 >>> 0 >= l2 >>> 0) {break L1;}l4 = HEAPU16[(l1) >> 1];if (l4 == l0) {break L0;}L3: {if (l4 == 92) {break L3;}switch (l4 + -10 | 0) {  case 0: case 3:break L1;  default:continue L2;}}l1 = l3 + 4 | 0;if ((HEAPU16[(l3 + 4) >> 1]) != 13) {continue L2;}l1 = ((HEAPU16[(l3 + 6) >> 1]) == 10) ? (l3 + 6 | 0) : l1;continue L2;}}HEAP32[(0 + 1296) >> 2] = l1;f66();return;}HEAP32[(0 + 1296) >> 2] = l1;}
+function f61(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0,t0 = 0,t1 = 0,t2 = 0,t3 = 0;l0 = HEAP32[(0 + 1264) >> 2];l1 = HEAPU16[(l0) >> 1];L0: {L1: {L2: {L3: {L4: {if ((HEAPU8[0 + 1221]) == 0) {break L4;}L5: {if (l1 == 62) {break L5;}if (l1 != 33) {break L4;}l2 = 0;L6: {if ((HEAP32[(0 + 1180) >> 2]) >>> 0 >= l0 >>> 0) {break L6;}l3 = 0;l2 = HEAPU16[(l0 + -2 | 0) >> 1];if (l2 == 41) {break L0;}if (l2 == 93) {break L0;}}t0 = f65(l2);if (t0 == 0) {break L3;}l3 = 0;t1 = f45(l0 + -2 | 0);if (t1) {break L3;}break L0;}l3 = 0;if (l0 != (HEAP32[(0 + 1276) >> 2])) {break L3;}break L0;}if (l1 >>> 0 > 127 >>> 0) {break L2;}}if (((HEAPU8[l1 + 1040 | 0]) & 16) == 0) {break L2;}l3 = 1;L7: {L8: {L9: {switch (l1 + -43 | 0) {  case 0:break L8;  case 2:break L7;  case 3:break L9;  default:break L0;}}if ((HEAP32[(0 + 1180) >> 2]) >>> 0 >= l0 >>> 0) {break L0;}if ((((HEAPU16[(l0 + -2 | 0) >> 1]) + -48 | 0) & 65535) >>> 0 < 10 >>> 0) {break L1;}break L0;}if ((HEAP32[(0 + 1180) >> 2]) >>> 0 >= l0 >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) == 43) {break L1;}break L0;}if ((HEAP32[(0 + 1180) >> 2]) >>> 0 >= l0 >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) == 45) {break L1;}break L0;}L10: {if (l1 == 125) {break L10;}L11: {if (l1 == 102) {break L11;}if (l1 != 41) {break L1;}l3 = 2;if ((((HEAPU8[((HEAP32[(0 + 1284) >> 2]) + ((HEAPU16[(0 + 1260) >> 1]) << 3) | 0) + 1]) + -1 | 0) & 255) >>> 0 >= 3 >>> 0) {break L1;}break L0;}if ((HEAP32[(0 + 1180) >> 2]) >>> 0 >= l0 >>> 0) {break L1;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 111) {break L1;}l2 = HEAPU16[(0 + 1260) >> 1];if (l2 == 0) {break L1;}l3 = 3;l2 = (HEAP32[(0 + 1284) >> 2]) + ((l2 + -1 | 0) << 3) | 0;if ((HEAPU8[l2]) != 1) {break L1;}if ((HEAPU8[l2 + 1]) != 2) {break L1;}break L0;}l3 = 4;l2 = (HEAP32[(0 + 1284) >> 2]) + ((HEAPU16[(0 + 1260) >> 1]) << 3) | 0;t2 = f76(l2);if (t2) {break L0;}if ((HEAPU8[l2]) == 6) {break L0;}}l3 = 5;t3 = f45(l0);if (t3) {break L0;}L12: {if (l1 != 47) {break L12;}l3 = 6;if ((HEAPU8[0 + 1280]) & 255) {break L0;}}L13: {if (l1) {break L13;}return 7;}L14: {l1 = HEAP32[(0 + 1208) >> 2];if (l1 == 0) {break L14;}if (l0 >>> 0 < (HEAP32[(l1) >> 2]) >>> 0) {break L14;}l3 = 8;if (l0 >>> 0 <= (HEAP32[(l1 + 4) >> 2]) >>> 0) {break L0;}}l3 = (l0 == (HEAP32[(0 + 1268) >> 2])) ? 9 : 0;}return l3;}
+function f62(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0,t0 = 0;L0: while (1) {l0 = HEAP32[(0 + 1300) >> 2];l1 = HEAP32[(0 + 1296) >> 2];L1: while (1) {l2 = l1 + 2 | 0;L2: {L3: {if (l1 >>> 0 >= l0 >>> 0) {break L3;}L4: {L5: {L6: {l3 = HEAPU16[(l2) >> 1];switch (l3 + -91 | 0) {  case 0:break L5;  case 1:break L4;  default:break L6;}}l1 = l2;switch (l3 + -10 | 0) {  case 0: case 3:break L3;  case 1: case 2:continue L1;  default:break L2;}}HEAP32[(0 + 1296) >> 2] = l2;t0 = f75();continue L0;}l1 = l1 + 4 | 0;continue L1;}HEAP32[(0 + 1296) >> 2] = l2;f66();return;}l1 = l2;if (l3 != 47) {continue L1;}break L1;}break L0;}HEAP32[(0 + 1296) >> 2] = l2;}
+function f63(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0;l0 = HEAP32[(0 + 1296) >> 2];l1 = HEAP32[(0 + 1300) >> 2];L0: {L1: {L2: {L3: while (1) {l2 = l0;l0 = l2 + 2 | 0;if (l2 >>> 0 >= l1 >>> 0) {break L2;}L4: {L5: {L6: {l3 = HEAPU16[(l0) >> 1];switch (l3 + -92 | 0) {  case 0:break L4;  case 1: case 2: case 3:continue L3;  case 4:break L5;  default:break L6;}}if (l3 != 36) {continue L3;}if ((HEAPU16[(l2 + 4) >> 1]) != 123) {continue L3;}l0 = l2 + 4 | 0;HEAP32[(0 + 1296) >> 2] = l0;l2 = HEAPU16[(0 + 1260) >> 1];HEAP16[(0 + 1260) >> 1] = l2 + 1 | 0;l2 = (HEAP32[(0 + 1284) >> 2]) + (l2 << 3) | 0;HEAP16[(l2) >> 1] = 4;HEAP32[(l2 + 4) >> 2] = l0;return;}HEAP32[(0 + 1296) >> 2] = l0;l0 = (HEAPU16[(0 + 1260) >> 1]) + -1 | 0;HEAP16[(0 + 1260) >> 1] = l0;if ((HEAPU8[(HEAP32[(0 + 1284) >> 2]) + ((l0 & 65535) << 3) | 0]) != 3) {break L1;}break L0;}l0 = l2 + 4 | 0;continue L3;}}HEAP32[(0 + 1296) >> 2] = l0;}f66();}}
+function f64(l0){var l1 = 0,t0 = 0,t1 = 0,t2 = 0;l1 = HEAPU16[(0 + 1272) >> 1];L0: {L1: {if (l0 != 60) {break L1;}L2: {if (l1 & 65535) {break L2;}l0 = HEAP32[(0 + 1264) >> 2];if (l0 != ((HEAP32[(0 + 1296) >> 2]) + -2 | 0)) {break L0;}t0 = f65(HEAPU16[(l0) >> 1]);if (t0 == 0) {break L0;}t1 = f45(l0);if (t1) {break L0;}}HEAP16[(0 + 1272) >> 1] = l1 + 1 | 0;return;}if ((l1 & 65535) == 0) {break L0;}L3: {L4: {L5: {if (l0 == 38) {break L5;}if (l0 == 124) {break L5;}if (l0 != 62) {break L4;}l0 = l1 + -1 | 0;HEAP16[(0 + 1272) >> 1] = l0;if (l0 & 65535) {break L0;}HEAP32[(0 + 1276) >> 2] = HEAP32[(0 + 1296) >> 2];return;}if ((HEAPU16[((HEAP32[(0 + 1296) >> 2]) + 2) >> 1]) == l0) {break L3;}}t2 = f65(l0);if (t2) {break L0;}L6: {l1 = l0 + -34 | 0;if (l1 >>> 0 > 12 >>> 0) {break L6;}if ((1 << l1) & 5169) {break L0;}}L7: {switch (l0 + -91 | 0) {  case 0: case 2:break L0;  case 1:break L3;  default:break L7;}}if (l0 == 124) {break L0;}}HEAP16[(0 + 1272) >> 1] = 0;}}
+function f65(l0){L0: {L1: {if (l0 >>> 0 > 127 >>> 0) {break L1;}l0 = (HEAPU8[l0 + 1040 | 0]) & 32;break L0;}l0 = (l0 != 160) | 0;}return (l0 != 0) | 0;}
+function f66(){var l0 = 0,l1 = 0,l2 = 0;L0: {L1: {if ((HEAPU8[0 + 1223]) == 0) {break L1;}l0 = HEAP32[(0 + 1300) >> 2];break L0;}l1 = HEAP32[(0 + 1180) >> 2];L2: {l2 = HEAP32[(0 + 1296) >> 2];l0 = HEAP32[(0 + 1300) >> 2];if (l2 >>> 0 < l0 >>> 0) {break L2;}if (l0 == ((l1 + ((HEAP32[(0 + 1224) >> 2]) << 1) | 0) + -2 | 0)) {break L2;}HEAP8[0 + 1232] = 1;}HEAP8[0 + 1223] = 1;HEAP32[(0 + 1252) >> 2] = (l2 - l1 | 0) >> 1;}HEAP32[(0 + 1296) >> 2] = l0 + 2 | 0;}
+function f67(l0){L0: {if (l0 >>> 0 > 127 >>> 0) {break L0;}return (HEAPU8[l0 + 1040 | 0]) & 1;}return (l0 == 160) | 0;}
+function f68(l0){var l1 = 0,l2 = 0,l3 = 0,l4 = 0,t0 = 0,t1 = 0;L0: {l1 = HEAP32[(0 + 1296) >> 2];l2 = HEAP32[(0 + 1300) >> 2];l3 = l2 + 2 | 0;if (l1 >>> 0 <= l3 >>> 0) {break L0;}HEAP32[(0 + 1296) >> 2] = l3;l1 = l3;}L1: {L2: while (1) {L3: {L4: {l4 = HEAPU16[(l1) >> 1];if (l4 != 47) {break L4;}L5: {L6: {l1 = HEAPU16[(l1 + 2) >> 1];if (l1 == 42) {break L6;}if (l1 != 47) {break L1;}f54();break L5;}f55(l0);}l3 = HEAP32[(0 + 1296) >> 2];l2 = HEAP32[(0 + 1300) >> 2];if (l3 >>> 0 <= l2 >>> 0) {break L3;}break L1;}L7: {if (l0 == 0) {break L7;}l3 = l1;t0 = f59(l4);if (t0) {break L3;}break L1;}l3 = l1;t1 = f67(l4);if (t1 == 0) {break L1;}}l1 = l3 + 2 | 0;HEAP32[(0 + 1296) >> 2] = l1;if (l3 >>> 0 < l2 >>> 0) {continue L2;}break L2;}}return l4;}
+function f69(l0){var l1 = 0,l2 = 0;l1 = 0;L0: {if ((HEAPU16[(l0) >> 1]) != 46) {break L0;}l1 = 0;l2 = l0 + -4 | 0;if (l2 >>> 0 < (HEAP32[(0 + 1180) >> 2]) >>> 0) {break L0;}if ((HEAPU16[(l0 + -2 | 0) >> 1]) != 46) {break L0;}l1 = ((HEAPU16[(l2) >> 1]) == 46) | 0;}return l1;}
+function f70(l0){var l1 = 0,l2 = 0,t0 = 0;l1 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;L0: {L1: while (1) {l2 = l0 & 65535;if (l2 == 0) {break L0;}t0 = f59(l2);if (t0) {break L0;}L2: {if (l2 >>> 0 > 127 >>> 0) {break L2;}if ((HEAPU8[l2 + 1040 | 0]) & 4) {break L0;}}HEAP32[(0 + 1296) >> 2] = l1;l0 = HEAPU16[(l1) >> 1];l1 = l1 + 2 | 0;continue L1;}}return l0 & 65535;}
+function f71(l0,l1,l2){var l3 = 0,l4 = 0,t0 = 0,t1 = 0,t2 = 0,t3 = 0,t4 = 0,t5 = 0,t6 = 0,t7 = 0,t8 = 0,t9 = 0,t10 = 0;l3 = HEAP32[(0 + 1296) >> 2];L0: {L1: {if (l1 != 39) {break L1;}l4 = l1;break L0;}l4 = 34;if (l1 == 34) {break L0;}f66();return;}f60(l4);f2(l0, l3 + 2 | 0, HEAP32[(0 + 1296) >> 2], HEAP32[(0 + 1168) >> 2]);L2: {if (l2 < 1) {break L2;}HEAP32[((HEAP32[(0 + 1200) >> 2]) + 28) >> 2] = (l2 == 1) ? 4 : 6;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t0 = f68(0);l1 = t0;L3: {l2 = HEAP32[(0 + 1296) >> 2];t1 = f26(l2);if (t1) {break L3;}t2 = f44(l2);if (t2) {break L3;}HEAP32[(0 + 1296) >> 2] = l2 + -2 | 0;return;}HEAP32[(0 + 1296) >> 2] = l2 + ((l1 == 97) ? 12 : 8) | 0;L4: {t3 = f68(1);if (t3 == 123) {break L4;}HEAP32[(0 + 1296) >> 2] = l2;return;}l0 = HEAP32[(0 + 1296) >> 2];l1 = l0;L5: {L6: while (1) {HEAP32[(0 + 1296) >> 2] = l1 + 2 | 0;L7: {L8: {L9: {t4 = f68(1);l1 = t4;if (l1 == 34) {break L9;}if (l1 != 39) {break L8;}f60(39);HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t5 = f68(1);l1 = t5;break L7;}f60(34);HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t6 = f68(1);l1 = t6;break L7;}t7 = f70(l1);l1 = t7;}L10: {if (l1 == 58) {break L10;}HEAP32[(0 + 1296) >> 2] = l2;return;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;L11: {t8 = f68(1);l1 = t8;if (l1 == 39) {break L11;}if (l1 != 34) {break L5;}l1 = 34;}f60(l1);HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;L12: {L13: {t9 = f68(1);l1 = t9;if (l1 == 44) {break L13;}if (l1 == 125) {break L12;}HEAP32[(0 + 1296) >> 2] = l2;return;}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;t10 = f68(1);if (t10 == 125) {break L12;}l1 = HEAP32[(0 + 1296) >> 2];continue L6;}break L6;}l1 = HEAP32[(0 + 1200) >> 2];HEAP32[(l1 + 16) >> 2] = l0;HEAP32[(l1 + 12) >> 2] = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;return;}HEAP32[(0 + 1296) >> 2] = l2;}
+function f72(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0,l4 = 0,t0 = 0,t1 = 0,t2 = 0;l0 = 0;l1 = 0;L0: {L1: while (1) {t0 = f68(1);l2 = t0;l3 = HEAP32[(0 + 1296) >> 2];if (l3 >>> 0 >= (HEAP32[(0 + 1300) >> 2]) >>> 0) {break L0;}if (l2 == 44) {break L0;}if (l2 == 125) {break L0;}if (l0 >>> 0 > 4 >>> 0) {break L0;}L2: {L3: {L4: {L5: {if (l2 == 39) {break L5;}if (l2 != 34) {break L4;}}f60(l2);l2 = HEAP32[(0 + 1296) >> 2];break L3;}t1 = f70(l2);l2 = l3;l4 = HEAP32[(0 + 1296) >> 2];if (l4 != l3) {break L2;}}l4 = l2 + 2 | 0;HEAP32[(0 + 1296) >> 2] = l4;}l0 = l0 + 1 | 0;if (l0 != 1) {continue L1;}l1 = 0;if ((l4 - l3 | 0) != 8) {continue L1;}t2 = f43(l3);l1 = t2;continue L1;}}l2 = 0;L6: {if ((l1 & 1) == 0) {break L6;}l2 = ((l0 == 2) | 0) | ((l0 == 4) | 0);}return l2;}
+function f73(l0){var l1 = 0,t0 = 0;HEAP8[0 + 1256] = 0;L0: {if (l0 == 34) {break L0;}if (l0 == 39) {break L0;}l1 = HEAP32[(0 + 1296) >> 2];t0 = f70(l0);l0 = HEAP32[(0 + 1296) >> 2];if (l0 >>> 0 <= l1 >>> 0) {break L0;}f3(l1, l0, l1, l0);}HEAP32[(0 + 1296) >> 2] = (HEAP32[(0 + 1296) >> 2]) + -2 | 0;}
+function f74(l0,l1){var l2 = 0,l3 = 0,l4 = 0,l5 = 0,t0 = 0,t1 = 0,t2 = 0;L0: {L1: {l2 = HEAP32[(0 + 1296) >> 2];l3 = HEAPU16[(l2) >> 1];if (l3 == 97) {break L1;}l4 = l1;l5 = l0;break L0;}HEAP32[(0 + 1296) >> 2] = l2 + 4 | 0;t0 = f68(1);l2 = t0;l5 = HEAP32[(0 + 1296) >> 2];L2: {L3: {if (l2 == 34) {break L3;}if (l2 == 39) {break L3;}t1 = f70(l2);l4 = HEAP32[(0 + 1296) >> 2];break L2;}f60(l2);l4 = (HEAP32[(0 + 1296) >> 2]) + 2 | 0;HEAP32[(0 + 1296) >> 2] = l4;}t2 = f68(1);l3 = t2;l2 = HEAP32[(0 + 1296) >> 2];}L4: {if (l2 == l5) {break L4;}l2 = (l0 == l1) | 0;f3(l5, l4, l2 ? 0 : l0, l2 ? 0 : l1);}return l3;}
+function f75(){var l0 = 0,l1 = 0,l2 = 0,l3 = 0;l0 = HEAP32[(0 + 1296) >> 2];l1 = HEAP32[(0 + 1300) >> 2];L0: {L1: {L2: while (1) {l2 = l0 + 2 | 0;if (l0 >>> 0 >= l1 >>> 0) {break L1;}L3: {L4: {l3 = HEAPU16[(l2) >> 1];switch (l3 + -92 | 0) {  case 0:break L3;  case 1:break L0;  default:break L4;}}l0 = l2;switch (l3 + -10 | 0) {  case 0: case 3:break L1;  default:continue L2;}}l0 = l0 + 4 | 0;continue L2;}}HEAP32[(0 + 1296) >> 2] = l2;f66();return 0;}HEAP32[(0 + 1296) >> 2] = l2;return 93;}
+function f76(l0){var l1 = 0,l2 = 0,l3 = 0;l1 = 1;L0: {L1: {L2: {L3: {l2 = HEAP32[(l0 + 4) >> 2];l3 = HEAPU16[(l2) >> 1];switch (l3 + -59 | 0) {  case 0:break L0;  case 1: case 2:break L1;  case 3:break L3;  default:break L2;}}l1 = 0;if ((HEAP32[(0 + 1180) >> 2]) >>> 0 >= l2 >>> 0) {break L0;}return ((HEAPU16[(l2 + -2 | 0) >> 1]) == 61) | 0;}if (l3 == 41) {break L0;}}l1 = ((((HEAPU8[l0 + 1]) + -4 | 0) & 255) >>> 0 < 3 >>> 0) | 0;}return l1;}
+  function su(a) {
+    a = a | 0;
+    sp = a + (2 << 17) & -16;
+    return 1312;
+  }
+  return {
+    su,
+    p: f24,
+    sa: f1,
+    e: f5,
+    ri: f19,
+    re: f20,
+    it: f11,
+    is: f7,
+    ie: f8,
+    ss: f9,
+    ip: f14,
+    se: f10,
+    ai: f12,
+    id: f13,
+    es: f15,
+    ee: f16,
+    els: f17,
+    ele: f18,
+    f: f21,
+    ms: f22,
+    md: f23,
+    sb: f4,
+    bx: f6,
+    ses: f0
+  };
+}
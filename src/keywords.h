@@ -0,0 +1,287 @@
+// Generated from src/keywords.json by `chomp src/keywords.h`, do not edit.
+// Keywords are compared against character immediates rather than strings in
+// the data section, which the asm.js build does not initialize.
+
+bool matchesAbstract (char16_t* pos) {
+  return *pos == 'a' && *(pos + 1) == 'b' && *(pos + 2) == 's' && *(pos + 3) == 't' && *(pos + 4) == 'r' && *(pos + 5) == 'a' && *(pos + 6) == 'c' && *(pos + 7) == 't';
+}
+
+bool matchesAs (char16_t* pos) {
+  return *pos == 'a' && *(pos + 1) == 's';
+}
+
+bool matchesAssert (char16_t* pos) {
+  return *pos == 'a' && *(pos + 1) == 's' && *(pos + 2) == 's' && *(pos + 3) == 'e' && *(pos + 4) == 'r' && *(pos + 5) == 't';
+}
+
+bool matchesAsync (char16_t* pos) {
+  return *pos == 'a' && *(pos + 1) == 's' && *(pos + 2) == 'y' && *(pos + 3) == 'n' && *(pos + 4) == 'c';
+}
+
+bool matchesClass (char16_t* pos) {
+  return *pos == 'c' && *(pos + 1) == 'l' && *(pos + 2) == 'a' && *(pos + 3) == 's' && *(pos + 4) == 's';
+}
+
+bool matchesConst (char16_t* pos) {
+  return *pos == 'c' && *(pos + 1) == 'o' && *(pos + 2) == 'n' && *(pos + 3) == 's' && *(pos + 4) == 't';
+}
+
+bool matchesDeclare (char16_t* pos) {
+  return *pos == 'd' && *(pos + 1) == 'e' && *(pos + 2) == 'c' && *(pos + 3) == 'l' && *(pos + 4) == 'a' && *(pos + 5) == 'r' && *(pos + 6) == 'e';
+}
+
+bool matchesDefer (char16_t* pos) {
+  return *pos == 'd' && *(pos + 1) == 'e' && *(pos + 2) == 'f' && *(pos + 3) == 'e' && *(pos + 4) == 'r';
+}
+
+bool matchesEnum (char16_t* pos) {
+  return *pos == 'e' && *(pos + 1) == 'n' && *(pos + 2) == 'u' && *(pos + 3) == 'm';
+}
+
+bool matchesExport (char16_t* pos) {
+  return *pos == 'e' && *(pos + 1) == 'x' && *(pos + 2) == 'p' && *(pos + 3) == 'o' && *(pos + 4) == 'r' && *(pos + 5) == 't';
+}
+
+bool matchesFrom (char16_t* pos) {
+  return *pos == 'f' && *(pos + 1) == 'r' && *(pos + 2) == 'o' && *(pos + 3) == 'm';
+}
+
+bool matchesFunction (char16_t* pos) {
+  return *pos == 'f' && *(pos + 1) == 'u' && *(pos + 2) == 'n' && *(pos + 3) == 'c' && *(pos + 4) == 't' && *(pos + 5) == 'i' && *(pos + 6) == 'o' && *(pos + 7) == 'n';
+}
+
+bool matchesImport (char16_t* pos) {
+  return *pos == 'i' && *(pos + 1) == 'm' && *(pos + 2) == 'p' && *(pos + 3) == 'o' && *(pos + 4) == 'r' && *(pos + 5) == 't';
+}
+
+bool matchesInterface (char16_t* pos) {
+  return *pos == 'i' && *(pos + 1) == 'n' && *(pos + 2) == 't' && *(pos + 3) == 'e' && *(pos + 4) == 'r' && *(pos + 5) == 'f' && *(pos + 6) == 'a' && *(pos + 7) == 'c' && *(pos + 8) == 'e';
+}
+
+bool matchesMeta (char16_t* pos) {
+  return *pos == 'm' && *(pos + 1) == 'e' && *(pos + 2) == 't' && *(pos + 3) == 'a';
+}
+
+bool matchesModule (char16_t* pos) {
+  return *pos == 'm' && *(pos + 1) == 'o' && *(pos + 2) == 'd' && *(pos + 3) == 'u' && *(pos + 4) == 'l' && *(pos + 5) == 'e';
+}
+
+bool matchesNamespace (char16_t* pos) {
+  return *pos == 'n' && *(pos + 1) == 'a' && *(pos + 2) == 'm' && *(pos + 3) == 'e' && *(pos + 4) == 's' && *(pos + 5) == 'p' && *(pos + 6) == 'a' && *(pos + 7) == 'c' && *(pos + 8) == 'e';
+}
+
+bool matchesRequire (char16_t* pos) {
+  return *pos == 'r' && *(pos + 1) == 'e' && *(pos + 2) == 'q' && *(pos + 3) == 'u' && *(pos + 4) == 'i' && *(pos + 5) == 'r' && *(pos + 6) == 'e';
+}
+
+bool matchesSource (char16_t* pos) {
+  return *pos == 's' && *(pos + 1) == 'o' && *(pos + 2) == 'u' && *(pos + 3) == 'r' && *(pos + 4) == 'c' && *(pos + 5) == 'e';
+}
+
+bool matchesType (char16_t* pos) {
+  return *pos == 't' && *(pos + 1) == 'y' && *(pos + 2) == 'p' && *(pos + 3) == 'e';
+}
+
+bool matchesWith (char16_t* pos) {
+  return *pos == 'w' && *(pos + 1) == 'i' && *(pos + 2) == 't' && *(pos + 3) == 'h';
+}
+
+bool matchesHtmlIframe (const char16_t* pos) {
+  return (*pos | 0x20) == 'i' && (*(pos + 1) | 0x20) == 'f' && (*(pos + 2) | 0x20) == 'r' && (*(pos + 3) | 0x20) == 'a' && (*(pos + 4) | 0x20) == 'm' && (*(pos + 5) | 0x20) == 'e';
+}
+
+bool matchesHtmlImportmap (const char16_t* pos) {
+  return (*pos | 0x20) == 'i' && (*(pos + 1) | 0x20) == 'm' && (*(pos + 2) | 0x20) == 'p' && (*(pos + 3) | 0x20) == 'o' && (*(pos + 4) | 0x20) == 'r' && (*(pos + 5) | 0x20) == 't' && (*(pos + 6) | 0x20) == 'm' && (*(pos + 7) | 0x20) == 'a' && (*(pos + 8) | 0x20) == 'p';
+}
+
+bool matchesHtmlModule (const char16_t* pos) {
+  return (*pos | 0x20) == 'm' && (*(pos + 1) | 0x20) == 'o' && (*(pos + 2) | 0x20) == 'd' && (*(pos + 3) | 0x20) == 'u' && (*(pos + 4) | 0x20) == 'l' && (*(pos + 5) | 0x20) == 'e';
+}
+
+bool matchesHtmlNoembed (const char16_t* pos) {
+  return (*pos | 0x20) == 'n' && (*(pos + 1) | 0x20) == 'o' && (*(pos + 2) | 0x20) == 'e' && (*(pos + 3) | 0x20) == 'm' && (*(pos + 4) | 0x20) == 'b' && (*(pos + 5) | 0x20) == 'e' && (*(pos + 6) | 0x20) == 'd';
+}
+
+bool matchesHtmlNoframes (const char16_t* pos) {
+  return (*pos | 0x20) == 'n' && (*(pos + 1) | 0x20) == 'o' && (*(pos + 2) | 0x20) == 'f' && (*(pos + 3) | 0x20) == 'r' && (*(pos + 4) | 0x20) == 'a' && (*(pos + 5) | 0x20) == 'm' && (*(pos + 6) | 0x20) == 'e' && (*(pos + 7) | 0x20) == 's';
+}
+
+bool matchesHtmlNoscript (const char16_t* pos) {
+  return (*pos | 0x20) == 'n' && (*(pos + 1) | 0x20) == 'o' && (*(pos + 2) | 0x20) == 's' && (*(pos + 3) | 0x20) == 'c' && (*(pos + 4) | 0x20) == 'r' && (*(pos + 5) | 0x20) == 'i' && (*(pos + 6) | 0x20) == 'p' && (*(pos + 7) | 0x20) == 't';
+}
+
+bool matchesHtmlPlaintext (const char16_t* pos) {
+  return (*pos | 0x20) == 'p' && (*(pos + 1) | 0x20) == 'l' && (*(pos + 2) | 0x20) == 'a' && (*(pos + 3) | 0x20) == 'i' && (*(pos + 4) | 0x20) == 'n' && (*(pos + 5) | 0x20) == 't' && (*(pos + 6) | 0x20) == 'e' && (*(pos + 7) | 0x20) == 'x' && (*(pos + 8) | 0x20) == 't';
+}
+
+bool matchesHtmlScript (const char16_t* pos) {
+  return (*pos | 0x20) == 's' && (*(pos + 1) | 0x20) == 'c' && (*(pos + 2) | 0x20) == 'r' && (*(pos + 3) | 0x20) == 'i' && (*(pos + 4) | 0x20) == 'p' && (*(pos + 5) | 0x20) == 't';
+}
+
+bool matchesHtmlSrc (const char16_t* pos) {
+  return (*pos | 0x20) == 's' && (*(pos + 1) | 0x20) == 'r' && (*(pos + 2) | 0x20) == 'c';
+}
+
+bool matchesHtmlStyle (const char16_t* pos) {
+  return (*pos | 0x20) == 's' && (*(pos + 1) | 0x20) == 't' && (*(pos + 2) | 0x20) == 'y' && (*(pos + 3) | 0x20) == 'l' && (*(pos + 4) | 0x20) == 'e';
+}
+
+bool matchesHtmlTextarea (const char16_t* pos) {
+  return (*pos | 0x20) == 't' && (*(pos + 1) | 0x20) == 'e' && (*(pos + 2) | 0x20) == 'x' && (*(pos + 3) | 0x20) == 't' && (*(pos + 4) | 0x20) == 'a' && (*(pos + 5) | 0x20) == 'r' && (*(pos + 6) | 0x20) == 'e' && (*(pos + 7) | 0x20) == 'a';
+}
+
+bool matchesHtmlTitle (const char16_t* pos) {
+  return (*pos | 0x20) == 't' && (*(pos + 1) | 0x20) == 'i' && (*(pos + 2) | 0x20) == 't' && (*(pos + 3) | 0x20) == 'l' && (*(pos + 4) | 0x20) == 'e';
+}
+
+bool matchesHtmlType (const char16_t* pos) {
+  return (*pos | 0x20) == 't' && (*(pos + 1) | 0x20) == 'y' && (*(pos + 2) | 0x20) == 'p' && (*(pos + 3) | 0x20) == 'e';
+}
+
+bool matchesHtmlXmp (const char16_t* pos) {
+  return (*pos | 0x20) == 'x' && (*(pos + 1) | 0x20) == 'm' && (*(pos + 2) | 0x20) == 'p';
+}
+
+bool isExpressionKeyword (char16_t* pos) {
+  switch (*pos) {
+    case 'd':
+      if (pos - 1 < source)
+        return false;
+      switch (*(pos - 1)) {
+        case 'i':
+          // void
+          return pos - 3 >= source && *(pos - 2) == 'o' && *(pos - 3) == 'v' && keywordStart(pos - 3);
+        case 'l':
+          // yield
+          return pos - 4 >= source && *(pos - 2) == 'e' && *(pos - 3) == 'i' && *(pos - 4) == 'y' && keywordStart(pos - 4);
+      }
+      return false;
+    case 'e':
+      if (pos - 1 < source)
+        return false;
+      switch (*(pos - 1)) {
+        case 's':
+          if (pos - 2 < source)
+            return false;
+          switch (*(pos - 2)) {
+            case 'a':
+              // case
+              return pos - 3 >= source && *(pos - 3) == 'c' && keywordStart(pos - 3);
+            case 'l':
+              // else
+              return pos - 3 >= source && *(pos - 3) == 'e' && keywordStart(pos - 3);
+          }
+          return false;
+        case 't':
+          // delete
+          return pos - 5 >= source && *(pos - 2) == 'e' && *(pos - 3) == 'l' && *(pos - 4) == 'e' && *(pos - 5) == 'd' && keywordStart(pos - 5);
+        case 'u':
+          // continue
+          return pos - 7 >= source && *(pos - 2) == 'n' && *(pos - 3) == 'i' && *(pos - 4) == 't' && *(pos - 5) == 'n' && *(pos - 6) == 'o' && *(pos - 7) == 'c' && keywordStart(pos - 7);
+      }
+      return false;
+    case 'f':
+      if (pos - 1 < source)
+        return false;
+      switch (*(pos - 1)) {
+        case 'o':
+          if (pos - 2 < source)
+            return false;
+          switch (*(pos - 2)) {
+            case 'e':
+              if (pos - 3 < source)
+                return false;
+              switch (*(pos - 3)) {
+                case 'c':
+                  // instanceof
+                  return pos - 9 >= source && *(pos - 4) == 'n' && *(pos - 5) == 'a' && *(pos - 6) == 't' && *(pos - 7) == 's' && *(pos - 8) == 'n' && *(pos - 9) == 'i' && keywordStart(pos - 9);
+                case 'p':
+                  // typeof
+                  return pos - 5 >= source && *(pos - 4) == 'y' && *(pos - 5) == 't' && keywordStart(pos - 5);
+              }
+              return false;
+          }
+          return false;
+      }
+      return false;
+    case 'k':
+      // break
+      return pos - 4 >= source && *(pos - 1) == 'a' && *(pos - 2) == 'e' && *(pos - 3) == 'r' && *(pos - 4) == 'b' && keywordStart(pos - 4);
+    case 'n':
+      if (pos - 1 < source)
+        return false;
+      switch (*(pos - 1)) {
+        case 'i':
+          // in
+          return pos - 1 >= source && keywordStart(pos - 1);
+        case 'r':
+          // return
+          return pos - 5 >= source && *(pos - 2) == 'u' && *(pos - 3) == 't' && *(pos - 4) == 'e' && *(pos - 5) == 'r' && keywordStart(pos - 5);
+      }
+      return false;
+    case 'o':
+      // do
+      return pos - 1 >= source && *(pos - 1) == 'd' && keywordStart(pos - 1);
+    case 'r':
+      // debugger
+      return pos - 7 >= source && *(pos - 1) == 'e' && *(pos - 2) == 'g' && *(pos - 3) == 'g' && *(pos - 4) == 'u' && *(pos - 5) == 'b' && *(pos - 6) == 'e' && *(pos - 7) == 'd' && keywordStart(pos - 7);
+    case 't':
+      // await
+      return pos - 4 >= source && *(pos - 1) == 'i' && *(pos - 2) == 'a' && *(pos - 3) == 'w' && *(pos - 4) == 'a' && keywordStart(pos - 4);
+    case 'w':
+      if (pos - 1 < source)
+        return false;
+      switch (*(pos - 1)) {
+        case 'e':
+          // new
+          return pos - 2 >= source && *(pos - 2) == 'n' && keywordStart(pos - 2);
+        case 'o':
+          // throw
+          return pos - 4 >= source && *(pos - 2) == 'r' && *(pos - 3) == 'h' && *(pos - 4) == 't' && keywordStart(pos - 4);
+      }
+      return false;
+  }
+  return false;
+}
+
+bool isBreakOrContinue (char16_t* pos) {
+  switch (*pos) {
+    case 'e':
+      // continue
+      return pos - 7 >= source && *(pos - 1) == 'u' && *(pos - 2) == 'n' && *(pos - 3) == 'i' && *(pos - 4) == 't' && *(pos - 5) == 'n' && *(pos - 6) == 'o' && *(pos - 7) == 'c' && keywordStart(pos - 7);
+    case 'k':
+      // break
+      return pos - 4 >= source && *(pos - 1) == 'a' && *(pos - 2) == 'e' && *(pos - 3) == 'r' && *(pos - 4) == 'b' && keywordStart(pos - 4);
+  }
+  return false;
+}
+
+enum OpenTokenKeyword readParenKeyword (char16_t* pos) {
+  switch (*pos) {
+    case 'e':
+      // while
+      return pos - 4 >= source && *(pos - 1) == 'l' && *(pos - 2) == 'i' && *(pos - 3) == 'h' && *(pos - 4) == 'w' && keywordStart(pos - 4) ? While : NoKeyword;
+    case 'f':
+      // if
+      return pos - 1 >= source && *(pos - 1) == 'i' && keywordStart(pos - 1) ? If : NoKeyword;
+    case 'r':
+      // for
+      return pos - 2 >= source && *(pos - 1) == 'o' && *(pos - 2) == 'f' && keywordStart(pos - 2) ? For : NoKeyword;
+  }
+  return NoKeyword;
+}
+
+enum OpenTokenKeyword readBraceKeyword (char16_t* pos) {
+  switch (*pos) {
+    case 'e':
+      // else
+      return pos - 3 >= source && *(pos - 1) == 's' && *(pos - 2) == 'l' && *(pos - 3) == 'e' && keywordStart(pos - 3) ? Else : NoKeyword;
+    case 'h':
+      // catch
+      return pos - 4 >= source && *(pos - 1) == 'c' && *(pos - 2) == 't' && *(pos - 3) == 'a' && *(pos - 4) == 'c' && keywordStart(pos - 4) ? Catch : NoKeyword;
+    case 'y':
+      // finally
+      return pos - 6 >= source && *(pos - 1) == 'l' && *(pos - 2) == 'l' && *(pos - 3) == 'a' && *(pos - 4) == 'n' && *(pos - 5) == 'i' && *(pos - 6) == 'f' && keywordStart(pos - 6) ? Finally : NoKeyword;
+  }
+  return NoKeyword;
+}
@@ -14,31 +14,13 @@ const copy = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1 ? function (sr
   }
 };
 
-const words = 'xportmportlassforetaourceeferromsyncunctionssertvoyiedelecontininstantybreareturdebuggeawaithrwhileifcatcfinallels';
-
 let source, name;
-export function parse (_source, _name = '@') {
-  source = _source;
-  name = _name;
-  // 2 bytes per string code point
-  // + analysis space (2^17)
-  // remaining space is EMCC stack space (2^17)
-  const memBound = source.length * 2 + (2 << 18);
-  if (memBound > allocSize || !asm) {
-    while (memBound > allocSize) allocSize *= 2;
-    asmBuffer = new ArrayBuffer(allocSize);
-    copy(words, new Uint16Array(asmBuffer, 16, words.length));
-    asm = asmInit(typeof self !== 'undefined' ? self : global, {}, asmBuffer);
-    // lexer.c bulk allocates string space + analysis space
-    addr = asm.su(allocSize - (2<<17));
-  }
-  const len = source.length + 1;
-  asm.ses(addr);
-  asm.sa(len - 1);
-
-  copy(source, new Uint16Array(asmBuffer, addr, len));
+export function parse (_source, _name = '@', budget = 0) {
+  copySource(_source, _name);
+  if (budget > 0)
+    asm.sb(budget);
 
-  if (!asm.p()) {
+  if (!asm.p() && !asm.bx()) {
     acornPos = asm.e();
     syntaxError();
   }
@@ -62,7 +44,47 @@ export function parse (_source, _name = '@') {
     });
   }
 
-  return [imports, exports, !!asm.f(), !!asm.ms()];
+  return [imports, exports, !!asm.f(), !!asm.ms(), !!asm.bx()];
+}
+
+export function detectModuleSyntax (_source, _name = '@') {
+  copySource(_source, _name);
+
+  if (!asm.md()) {
+    acornPos = asm.e();
+    syntaxError();
+  }
+
+  return !!asm.ms();
+}
+
+export function resetMemory (threshold = 0) {
+  if (!asm || allocSize <= threshold)
+    return false;
+  asm = asmBuffer = undefined;
+  allocSize = 2<<19;
+  return true;
+}
+
+function copySource (_source, _name) {
+  source = _source;
+  name = _name;
+  // 2 bytes per string code point
+  // + analysis space (2^17)
+  // remaining space is EMCC stack space (2^17)
+  const memBound = source.length * 2 + (2 << 18);
+  if (memBound > allocSize || !asm) {
+    while (memBound > allocSize) allocSize *= 2;
+    asmBuffer = new ArrayBuffer(allocSize);
+    asm = asmInit(typeof self !== 'undefined' ? self : global, {}, asmBuffer);
+    // lexer.c bulk allocates string space + analysis space
+    addr = asm.su(allocSize - (2<<17));
+  }
+  const len = source.length + 1;
+  asm.ses(addr);
+  asm.sa(len - 1);
+
+  copy(source, new Uint16Array(asmBuffer, addr, len));
 }
 
 /*
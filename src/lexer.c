@@ -1,35 +1,32 @@
 #include "lexer.h"
+#include "keywords.h"
 #include <stdio.h>
 #include <string.h>
 
-// NOTE: MESSING WITH THESE REQUIRES MANUAL ASM DICTIONARY CONSTRUCTION (via lexer.emcc.js base64 decoding)
-static const char16_t XPORT[] = { 'x', 'p', 'o', 'r', 't' };
-static const char16_t MPORT[] = { 'm', 'p', 'o', 'r', 't' };
-static const char16_t LASS[] = { 'l', 'a', 's', 's' };
-static const char16_t ROM[] = { 'r', 'o', 'm' };
-static const char16_t ETA[] = { 'e', 't', 'a' };
-static const char16_t SSERT[] = { 's', 's', 'e', 'r', 't' };
-static const char16_t VO[] = { 'v', 'o' };
-static const char16_t YIE[] = { 'y', 'i', 'e' };
-static const char16_t DELE[] = { 'd', 'e', 'l', 'e' };
-static const char16_t INSTAN[] = { 'i', 'n', 's', 't', 'a', 'n' };
-static const char16_t TY[] = { 't', 'y' };
-static const char16_t RETUR[] = { 'r', 'e', 't', 'u', 'r' };
-static const char16_t DEBUGGE[] = { 'd', 'e', 'b', 'u', 'g', 'g', 'e' };
-static const char16_t AWAI[] = { 'a', 'w', 'a', 'i' };
-static const char16_t THR[] = { 't', 'h', 'r' };
-static const char16_t WHILE[] = { 'w', 'h', 'i', 'l', 'e' };
-static const char16_t FOR[] = { 'f', 'o', 'r' };
-static const char16_t IF[] = { 'i', 'f' };
-static const char16_t CATC[] = { 'c', 'a', 't', 'c' };
-static const char16_t FINALL[] = { 'f', 'i', 'n', 'a', 'l', 'l' };
-static const char16_t ELS[] = { 'e', 'l', 's' };
-static const char16_t BREA[] = { 'b', 'r', 'e', 'a' };
-static const char16_t CONTIN[] = { 'c', 'o', 'n', 't', 'i', 'n' };
-static const char16_t SYNC[] = {'s', 'y', 'n', 'c'};
-static const char16_t UNCTION[] = {'u', 'n', 'c', 't', 'i', 'o', 'n'};
-static const char16_t OURCE[] = {'o', 'u', 'r', 'c', 'e'};
-static const char16_t EFER[] = {'e', 'f', 'e', 'r'};
+// Character classes of the ASCII range, one flag per class, with a non-ASCII
+// slow path in the predicates below
+enum CharClass {
+  CharWsNotBr = 1,
+  CharBrOrWs = 2,
+  // !%&()*+,-./:;<=>?[]^{}|~
+  CharPunctuator = 4,
+  CharBrOrWsOrPunctuatorNotDot = 8,
+  // !%&(*+,-.:;<=>?[^{|~
+  CharExpressionPunctuator = 16,
+  // anything that does not end an identifier or number, or start a string or template
+  CharIdentifier = 32,
+};
+
+static const uint8_t CHAR_CLASS[128] = {
+   0, 32, 32, 32, 32, 32, 32, 32, 32, 11, 10, 11, 11, 10, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  11, 28,  0, 32, 32, 28, 28,  0, 28, 12, 28, 28, 28, 28, 20, 12,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 28, 28, 28, 28, 28, 28,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 28, 32, 12, 28, 32,
+   0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 28, 28, 12, 28, 32
+};
 
 // Note: parsing is based on the _assumption_ that the source is already valid
 bool parse () {
@@ -44,10 +41,16 @@ bool parse () {
   dynamicImportStackDepth = 0;
   openTokenDepth = 0;
   lastTokenPos = (char16_t*)EMPTY_CHAR;
+  breakLabelEnd = NULL;
+  typeArgumentsDepth = 0;
+  typeArgumentsEnd = NULL;
   lastSlashWasDivision = false;
   parse_error = 0;
   has_error = false;
   openTokenStack = &openTokenStack_[0];
+  // read as the closed token when a / follows a } that was never pushed, as
+  // at the end of export { ... } or of import attributes
+  openTokenStack[0] = (OpenToken){ AnyBrace, NoKeyword, (char16_t*)EMPTY_CHAR };
   dynamicImportStack = &dynamicImportStack_[0];
   nextBraceIsClass = false;
 
@@ -55,7 +58,22 @@ bool parse () {
   char16_t ch = '\0';
   end = pos + sourceLen;
 
+  // the work budget caps the lexed range, since every scanner loop is bounded by end
+  budgetExceeded = false;
+  cutStatementStart = NULL;
+  if (workBudget != 0 && workBudget < sourceLen)
+    end = pos + workBudget;
+
+#ifdef LEXER_THREADS
+  // a chunk of a parallel parse lexes with its own open token stack, and all
+  // but the first continue in the main loop from where it is set up
+  stopPos = end + 1;
+  if (chunk != NULL && beginChunk())
+    goto mainparse;
+#endif
+
   // start with a pure "module-only" parser
+  TRACE(facade);
   while (pos++ < end) {
     ch = *pos;
 
@@ -64,8 +82,12 @@ bool parse () {
 
     switch (ch) {
       case 'e':
-        if (openTokenDepth == 0 && keywordStart(pos) && memcmp(pos + 1, &XPORT[0], 5 * 2) == 0) {
+        if (openTokenDepth == 0 && keywordStart(pos) && matchesExport(pos)) {
+          char16_t* statementStart = pos;
           tryParseExportStatement();
+          endStatement(statementStart);
+          if (detectOnly && hasModuleSyntax)
+            return !has_error;
           // export might have been a non-pure declaration
           if (!facade) {
             lastTokenPos = pos;
@@ -74,8 +96,13 @@ bool parse () {
         }
         break;
       case 'i':
-        if (keywordStart(pos) && memcmp(pos + 1, &MPORT[0], 5 * 2) == 0)
+        if (keywordStart(pos) && matchesImport(pos)) {
+          char16_t* statementStart = pos;
           tryParseImportStatement();
+          endStatement(statementStart);
+          if (detectOnly && hasModuleSyntax)
+            return !has_error;
+        }
         break;
       case ';':
         break;
@@ -102,37 +129,75 @@ bool parse () {
     lastTokenPos = pos;
   }
 
-  if (has_error)
+  if (has_error) {
+    if (budgetExceeded)
+      trimToBudget();
     return false;
+  }
 
-  mainparse: while (pos++ < end) {
+  mainparse:
+  TRACE(mainparse);
+  while (pos++ < end) {
+#ifdef LEXER_THREADS
+    if (pos >= stopPos)
+      break;
+#endif
     ch = *pos;
 
     if (ch == 32 || ch < 14 && ch > 8)
       continue;
 
+    // the label of "break label" / "continue label" is read forward here, so
+    // that a following "/" can be resolved without backtracking
+    if (lastTokenPos != pos - 1 && (*lastTokenPos == 'k' || *lastTokenPos == 'e') && isBreakLabelStart(pos)) {
+      while (pos < end && !isBrOrWsOrPunctuatorNotDot(*(pos + 1)) && !isQuote(*(pos + 1)) && *(pos + 1) != '`')
+        pos++;
+      breakLabelEnd = pos;
+      lastTokenPos = pos;
+      continue;
+    }
+
     switch (ch) {
       case 'e':
-        if (openTokenDepth == 0 && keywordStart(pos) && memcmp(pos + 1, &XPORT[0], 5 * 2) == 0)
+#ifdef LEXER_THREADS
+        // a chunk records the depth as an assumption, so it is checked last,
+        // and not for exports and the like, which are no statement anyway
+        if (keywordStart(pos) && matchesExport(pos) && !isIdentifierChar(*(pos + 6)) && AT_TOP_LEVEL()) {
+#else
+        if (openTokenDepth == 0 && keywordStart(pos) && matchesExport(pos)) {
+#endif
+          char16_t* statementStart = pos;
           tryParseExportStatement();
+          endStatement(statementStart);
+          if (detectOnly && hasModuleSyntax)
+            return !has_error;
+        }
         break;
       case 'i':
-        if (keywordStart(pos) && memcmp(pos + 1, &MPORT[0], 5 * 2) == 0)
+        if (keywordStart(pos) && matchesImport(pos)) {
+          char16_t* statementStart = pos;
           tryParseImportStatement();
+          endStatement(statementStart);
+          if (detectOnly && hasModuleSyntax)
+            return !has_error;
+        }
         break;
       case 'c':
-        if (keywordStart(pos) && memcmp(pos + 1, &LASS[0], 4 * 2) == 0 && isBrOrWs(*(pos + 5)))
+        if (keywordStart(pos) && matchesClass(pos) && isBrOrWs(*(pos + 5)))
           nextBraceIsClass = true;
         break;
       case '(':
         openTokenStack[openTokenDepth].token = AnyParen;
+        openTokenStack[openTokenDepth].keyword = readParenKeyword(lastTokenPos);
         openTokenStack[openTokenDepth++].pos = lastTokenPos;
+        STAT_ADD(keyword_lookbacks, 1);
+        STAT_MAX(max_open_token_depth, openTokenDepth);
         break;
       case ')':
-        if (openTokenDepth == 0)
+        if (OPEN_TOKENS_EMPTY())
           return syntaxError(), false;
         openTokenDepth--;
-        if (dynamicImportStackDepth > 0 && openTokenStack[openTokenDepth].token == ImportParen) {
+        if (dynamicImportStackDepth > 0 && OPEN_TOKEN(openTokenDepth, IsImportParen)->token == ImportParen) {
           Import* cur_dynamic_import = dynamicImportStack[dynamicImportStackDepth - 1];
           if (cur_dynamic_import->end == 0)
             cur_dynamic_import->end = lastTokenPos + 1;
@@ -150,15 +215,20 @@ bool parse () {
             import_write_head->next = NULL;
           else
             first_import = NULL;
+          STAT_ADD(retracted_dynamic_imports, 1);
         }
         openTokenStack[openTokenDepth].token = nextBraceIsClass ? ClassBrace : AnyBrace;
+        openTokenStack[openTokenDepth].keyword = readBraceKeyword(lastTokenPos);
         openTokenStack[openTokenDepth++].pos = lastTokenPos;
         nextBraceIsClass = false;
+        STAT_ADD(keyword_lookbacks, 1);
+        STAT_MAX(max_open_token_depth, openTokenDepth);
         break;
       case '}':
-        if (openTokenDepth == 0)
+        if (OPEN_TOKENS_EMPTY())
           return syntaxError(), false;
-        if (openTokenStack[--openTokenDepth].token == TemplateBrace) {
+        openTokenDepth--;
+        if (OPEN_TOKEN(openTokenDepth, IsTemplateBrace)->token == TemplateBrace) {
           templateString();
         }
         break;
@@ -181,53 +251,50 @@ bool parse () {
           continue;
         }
         else {
-          // Division / regex ambiguity handling based on checking backtrack analysis of:
-          // - what token came previously (lastToken)
-          // - if a closing brace or paren, what token came before the corresponding
-          //   opening brace or paren (lastOpenTokenIndex)
-          char16_t lastToken = *lastTokenPos;
-          if (isExpressionPunctuator(lastToken) &&
-              !(lastToken == '.' && (*(lastTokenPos - 1) >= '0' && *(lastTokenPos - 1) <= '9')) &&
-              !(lastToken == '+' && *(lastTokenPos - 1) == '+') && !(lastToken == '-' && *(lastTokenPos - 1) == '-') ||
-              lastToken == ')' && isParenKeyword(openTokenStack[openTokenDepth].pos) ||
-              openTokenDepth > 0 && openTokenStack[openTokenDepth - 1].token == AnyParen && *(lastTokenPos) == 'f' && *(lastTokenPos - 1) == 'o' && readPrecedingKeywordn(openTokenStack[openTokenDepth - 1].pos, &FOR[0], 3) ||
-              lastToken == '}' && (isExpressionTerminator(openTokenStack[openTokenDepth].pos) || openTokenStack[openTokenDepth].token == ClassBrace) ||
-              isExpressionKeyword(lastTokenPos) ||
-              lastToken == '/' && lastSlashWasDivision ||
-              !lastToken) {
-            regularExpression();
-            lastSlashWasDivision = false;
-          }
-          else if (export_write_head != NULL && lastTokenPos >= export_write_head->start && lastTokenPos <= export_write_head->end) {
-            // export default /some-regexp/
+          enum SlashRule rule = slashRule();
+          STAT_ADD(slash_rules[rule], 1);
+          if (rule != Division) {
             regularExpression();
             lastSlashWasDivision = false;
           }
           else {
-            // Final check - if the last token was "break x" or "continue x"
-            while (lastTokenPos > source && !isBrOrWsOrPunctuatorNotDot(*(--lastTokenPos)));
-            if (isWsNotBr(*lastTokenPos)) {
-              while (lastTokenPos > source && isWsNotBr(*(--lastTokenPos)));
-              if (isBreakOrContinue(lastTokenPos)) {
-                regularExpression();
-                lastSlashWasDivision = false;
-                break;
-              }
-            }
             lastSlashWasDivision = true;
           }
         }
         break;
       }
       case '`':
+        openTokenStack[openTokenDepth].keyword = NoKeyword;
         openTokenStack[openTokenDepth].pos = lastTokenPos;
         openTokenStack[openTokenDepth++].token = Template;
+        STAT_MAX(max_open_token_depth, openTokenDepth);
         templateString();
         break;
     }
+    if (typescript)
+      readTypeArguments(ch);
+    // the rest of an identifier or number cannot start a token, so skip it in one go
+    if (isIdentifierChar(*pos)) {
+      while (pos < end && isIdentifierChar(*(pos + 1)))
+        pos++;
+    }
     lastTokenPos = pos;
   }
 
+#ifdef LEXER_THREADS
+  // the state is left for the next chunk, which checks the open tokens
+  if (chunk != NULL)
+    return !has_error;
+#endif
+
+  if (end != source + sourceLen - 1 && !has_error)
+    budgetExceeded = true;
+
+  if (budgetExceeded) {
+    trimToBudget();
+    return false;
+  }
+
   if (openTokenDepth || has_error || dynamicImportStackDepth)
     return false;
 
@@ -237,6 +304,7 @@ bool parse () {
 
 void tryParseImportStatement () {
   char16_t* startPos = pos;
+  typeOnly = false;
 
   pos += 6;
 
@@ -251,16 +319,16 @@ void tryParseImportStatement () {
     pos++;
     ch = commentWhitespace(true);
     // import.meta indicated by d == -2
-    if (ch == 'm' && memcmp(pos + 1, &ETA[0], 3 * 2) == 0 && (isSpread(lastTokenPos) || *lastTokenPos != '.')) {
+    if (matchesMeta(pos) && (isSpread(lastTokenPos) || *lastTokenPos != '.')) {
       addImport(startPos, startPos, pos + 4, IMPORT_META);
       return;
     }
-    else if (ch == 's' && memcmp(pos + 1, &OURCE[0], 5 * 2) == 0 && (isSpread(lastTokenPos) || *lastTokenPos != '.')) {
+    else if (matchesSource(pos) && (isSpread(lastTokenPos) || *lastTokenPos != '.')) {
       phase_keyword = 1;
       pos += 6;
       ch = commentWhitespace(true);
     }
-    else if (ch == 'd' && memcmp(pos + 1, &EFER[0], 4 * 2) == 0 && (isSpread(lastTokenPos) || *lastTokenPos != '.')) {
+    else if (matchesDefer(pos) && (isSpread(lastTokenPos) || *lastTokenPos != '.')) {
       phase_keyword = 2;
       pos += 5;
       ch = commentWhitespace(true);
@@ -269,17 +337,17 @@ void tryParseImportStatement () {
       return;
     }
   }
-  else if (pos > startPos + 6 && ch == 's' && memcmp(pos + 1, &OURCE[0], 5 * 2) == 0 && isBrOrWs(*(pos + 6))) {
+  else if (pos > startPos + 6 && matchesSource(pos) && isBrOrWs(*(pos + 6))) {
     phase_keyword = 1;
     pos += 6;
     ch = commentWhitespace(true);
     // need a space after the source keyword, and must not be followed by from keyword
-    if (pos == maybePhasePos + 6 || ch == 'f' && memcmp(pos + 1, &ROM[0], 3 * 2) == 0 && isBrOrWsOrPunctuatorNotDot(*(pos + 4))) {
+    if (pos == maybePhasePos + 6 || matchesFrom(pos) && isBrOrWsOrPunctuatorNotDot(*(pos + 4))) {
       pos = maybePhasePos;
       phase_keyword = 0;
     }
   }
-  else if (pos > startPos + 5 && ch == 'd' && memcmp(pos + 1, &EFER[0], 4 * 2) == 0 && isBrOrWs(*(pos + 5))) {
+  else if (pos > startPos + 5 && matchesDefer(pos) && isBrOrWs(*(pos + 5))) {
     phase_keyword = 2;
     pos += 5;
     ch = commentWhitespace(true);
@@ -289,11 +357,34 @@ void tryParseImportStatement () {
       phase_keyword = 0;
     }
   }
+  // TypeScript: import type A from, import type { A } from, import type * as A
+  // from, unlike a default import named type (import type from, import type, {})
+  else if (typescript && pos > startPos + 6 && matchesType(pos) && !isIdentifierChar(*(pos + 4))) {
+    pos += 4;
+    ch = commentWhitespace(true);
+    bool modifier = ch == '{' || ch == '*' || isIdentifierChar(ch);
+    if (modifier && matchesFrom(pos) && !isIdentifierChar(*(pos + 4))) {
+      // import type from from 'a'
+      char16_t* fromPos = pos;
+      pos += 4;
+      modifier = !isQuote(commentWhitespace(true));
+      pos = fromPos;
+    }
+    if (modifier) {
+      typeOnly = true;
+    }
+    else {
+      pos = maybePhasePos;
+      ch = *pos;
+    }
+  }
 
   // dynamic import
   if (ch == '(') {
     openTokenStack[openTokenDepth].token = ImportParen;
+    openTokenStack[openTokenDepth].keyword = NoKeyword;
     openTokenStack[openTokenDepth++].pos = pos;
+    STAT_MAX(max_open_token_depth, openTokenDepth);
     if (*lastTokenPos == '.')
       return;
     // dynamic import indicated by positive d
@@ -341,12 +432,32 @@ void tryParseImportStatement () {
 
   if (ch == '{' && phase_keyword == 0) {
     // import statement only permitted at base-level
-    if (openTokenDepth != 0) {
+    if (!AT_TOP_LEVEL()) {
       pos--;
       return;
     }
 
-    while (pos < end) {
+    if (typescript) {
+      // with every name marked type, TypeScript elides the whole import
+      bool names = false;
+      bool types = true;
+      pos++;
+      while (pos < end) {
+        ch = commentWhitespace(true);
+        if (ch == '}') {
+          pos++;
+          break;
+        }
+        if (ch == ',') {
+          pos++;
+          continue;
+        }
+        names = true;
+        types = readTypeSpecifier() && types;
+      }
+      typeOnly = typeOnly || names && types;
+    }
+    else while (pos < end) {
       ch = commentWhitespace(true);
       if (isQuote(ch)) {
         stringLiteral(ch);
@@ -358,12 +469,15 @@ void tryParseImportStatement () {
     }
 
     ch = commentWhitespace(true);
-    if (ch == 'f' && memcmp(pos + 1, &ROM[0], 3 * 2) != 0) {
+    if (ch == 'f' && !matchesFrom(pos)) {
       syntaxError();
       return;
     }
 
     pos += 4;
+    // unterminated or without a specifier before the end
+    if (pos > end)
+      return syntaxError();
     ch = commentWhitespace(true);
 
     if (!isQuote(ch)) {
@@ -382,10 +496,42 @@ void tryParseImportStatement () {
     }
     // import defer * as foo mandates *;
     // import statement only permitted at base-level
-    if (phase_keyword == 2 && ch != '*' || openTokenDepth != 0) {
+    if (phase_keyword == 2 && ch != '*' || !AT_TOP_LEVEL()) {
       pos--;
       return;
     }
+    // TypeScript: import A = require('a'), unlike import A = B.C, imports a
+    if (typescript && isIdentifierChar(ch)) {
+      char16_t* bindingPos = pos;
+      readToWsOrPunctuator(ch);
+      if (commentWhitespace(true) == '=') {
+        char16_t* equalsPos = pos;
+        pos++;
+        commentWhitespace(true);
+        if (matchesRequire(pos) && !isIdentifierChar(*(pos + 7))) {
+          pos += 7;
+          if (commentWhitespace(true) == '(') {
+            pos++;
+            ch = commentWhitespace(true);
+            if (isQuote(ch)) {
+              const char16_t* specifierStart = pos + 1;
+              stringLiteral(ch);
+              const char16_t* specifierEnd = pos;
+              pos++;
+              if (commentWhitespace(true) == ')') {
+                addImport(startPos, specifierStart, specifierEnd, STANDARD_IMPORT);
+                import_write_head->statement_end = pos + 1;
+                return;
+              }
+            }
+          }
+        }
+        // continue lexing from the =, as for any other expression
+        pos = equalsPos;
+        return;
+      }
+      pos = bindingPos;
+    }
     while (pos < end) {
       ch = *pos;
       if (isQuote(ch)) {
@@ -401,6 +547,7 @@ void tryParseImportStatement () {
 void tryParseExportStatement () {
   char16_t* sStartPos = pos;
   Export* prev_export_write_head = export_write_head;
+  typeOnly = false;
 
   pos += 6;
 
@@ -411,12 +558,93 @@ void tryParseExportStatement () {
   if (pos == curPos && !isPunctuator(ch))
     return;
 
+  if (typescript) {
+    // export declare ..., an ambient declaration without a runtime value
+    if (matchesDeclare(pos) && isBrOrWs(*(pos + 7))) {
+      pos += 7;
+      ch = commentWhitespace(true);
+      typeOnly = true;
+    }
+    // export abstract class name ...
+    if (matchesAbstract(pos) && isBrOrWs(*(pos + 8))) {
+      pos += 8;
+      ch = commentWhitespace(true);
+    }
+    // export type { name }, export type * from and export type name = ...
+    if (matchesType(pos) && !isIdentifierChar(*(pos + 4))) {
+      char16_t* typePos = pos;
+      pos += 4;
+      ch = commentWhitespace(true);
+      if (ch == '{' || ch == '*') {
+        typeOnly = true;
+      }
+      else if (pos > typePos + 4 && isIdentifierChar(ch)) {
+        typeOnly = true;
+        return addDeclarationExport(ch);
+      }
+      else {
+        pos = typePos;
+        ch = *pos;
+      }
+    }
+    // export interface name ...
+    if (matchesInterface(pos) && isBrOrWs(*(pos + 9))) {
+      pos += 9;
+      typeOnly = true;
+      return addDeclarationExport(commentWhitespace(true));
+    }
+    // export const enum name ..., which is only inlined when not declared
+    if (matchesConst(pos) && isBrOrWs(*(pos + 5))) {
+      char16_t* constPos = pos;
+      pos += 5;
+      commentWhitespace(true);
+      if (!matchesEnum(pos) || !isBrOrWs(*(pos + 4))) {
+        pos = constPos;
+        ch = *pos;
+      }
+    }
+    if (matchesEnum(pos) && isBrOrWs(*(pos + 4))) {
+      pos += 4;
+      return addDeclarationExport(commentWhitespace(true));
+    }
+    // export namespace name ... and export declare module 'name' ...
+    if (matchesNamespace(pos) && isBrOrWs(*(pos + 9))) {
+      pos += 9;
+      return addDeclarationExport(commentWhitespace(true));
+    }
+    if (matchesModule(pos) && isBrOrWs(*(pos + 6))) {
+      pos += 6;
+      return addDeclarationExport(commentWhitespace(true));
+    }
+    // export as namespace name, only declaring a global for UMD builds
+    if (matchesAs(pos) && isBrOrWs(*(pos + 2)))
+      return;
+  }
+
   if (ch == '{') {
+    // TypeScript: export { type name }, with the from import type-only too
+    // when every name is
+    bool typeStatement = typeOnly;
+    bool names = false;
+    bool types = true;
     pos++;
     ch = commentWhitespace(true);
     while (true) {
       char16_t* startPos = pos;
 
+      if (typescript && ch != '}' && ch != ',') {
+        bool typeSpecifier = readTypeSpecifier();
+        pos = startPos;
+        if (typeSpecifier) {
+          pos += 4;
+          ch = commentWhitespace(true);
+          startPos = pos;
+        }
+        typeOnly = typeStatement || typeSpecifier;
+        names = true;
+        types = types && typeSpecifier;
+      }
+
       if (!isQuote(ch)) {
         ch = readToWsOrPunctuator(ch);
       }
@@ -450,6 +678,7 @@ void tryParseExportStatement () {
         return syntaxError();
     }
     hasModuleSyntax = true; // to handle "export {}"
+    typeOnly = typeStatement || names && types;
     pos++;
     ch = commentWhitespace(true);
   }
@@ -470,10 +699,15 @@ void tryParseExportStatement () {
         pos += 7;
         ch = commentWhitespace(true);
         bool localName = false;
+        // TypeScript: export default abstract class name? {}
+        if (typescript && matchesAbstract(pos) && isBrOrWs(*(pos + 8))) {
+          pos += 8;
+          ch = commentWhitespace(true);
+        }
         switch (ch) {
           // export default async? function*? name? (){}
           case 'a':
-            if (memcmp(pos + 1, &SYNC[0], 4 * 2) == 0 && isWsNotBr(*(pos + 5))) {
+            if (matchesAsync(pos) && isWsNotBr(*(pos + 5))) {
               pos += 5;
               ch = commentWhitespace(false);
             }
@@ -482,7 +716,7 @@ void tryParseExportStatement () {
             }
           // fallthrough
           case 'f':
-            if (memcmp(pos + 1, &UNCTION[0], 7 * 2) == 0 && (isBrOrWs(*(pos + 8)) || *(pos + 8) == '*' || *(pos + 8) == '(')) {
+            if (matchesFunction(pos) && (isBrOrWs(*(pos + 8)) || *(pos + 8) == '*' || *(pos + 8) == '(')) {
               pos += 8;
               ch = commentWhitespace(true);
               if (ch == '*') {
@@ -497,7 +731,7 @@ void tryParseExportStatement () {
             break;
           case 'c':
             // export default class name? {}
-            if (memcmp(pos + 1, &LASS[0], 4 * 2) == 0 && (isBrOrWs(*(pos + 5)) || *(pos + 5) == '{')) {
+            if (matchesClass(pos) && (isBrOrWs(*(pos + 5)) || *(pos + 5) == '{')) {
               pos += 5;
               ch = commentWhitespace(true);
               if (ch == '{') {
@@ -506,6 +740,15 @@ void tryParseExportStatement () {
               localName = true;
             }
             break;
+          case 'i':
+            // TypeScript: export default interface name {}
+            if (typescript && matchesInterface(pos) && isBrOrWs(*(pos + 9))) {
+              pos += 9;
+              ch = commentWhitespace(true);
+              typeOnly = true;
+              localName = true;
+            }
+            break;
         }
         if (localName) {
           const char16_t* localStartPos = pos;
@@ -540,7 +783,7 @@ void tryParseExportStatement () {
 
       // export class name ...
       case 'c':
-        if (memcmp(pos + 1, &LASS[0], 4 * 2) == 0 && isBrOrWsOrPunctuatorNotDot(*(pos + 5))) {
+        if (matchesClass(pos) && isBrOrWsOrPunctuatorNotDot(*(pos + 5))) {
           pos += 5;
           ch = commentWhitespace(true);
           const char16_t* startPos = pos;
@@ -598,6 +841,9 @@ void tryParseExportStatement () {
         } while (true);
         // if stuck inside destructuring syntax, backtrack
         if (destructuring) {
+          // as for syntax errors, getting stuck at the budget limit cuts the statement off
+          if (pos >= end && end != source + sourceLen - 1)
+            budgetExceeded = true;
           pos = (char16_t*)destructuringPos - 1;
         }
         return;
@@ -608,7 +854,7 @@ void tryParseExportStatement () {
   }
 
   // from ...
-  if (ch == 'f' && memcmp(pos + 1, &ROM[0], 3 * 2) == 0) {
+  if (matchesFrom(pos)) {
     pos += 4;
     readImportString(sStartPos, commentWhitespace(true), false);
 
@@ -622,6 +868,48 @@ void tryParseExportStatement () {
   }
 }
 
+// TypeScript: export type name, interface name, enum name and namespace name,
+// without a name for export declare module 'name'
+void addDeclarationExport (char16_t ch) {
+  facade = false;
+  if (isQuote(ch)) {
+    pos--;
+    return;
+  }
+  const char16_t* startPos = pos;
+  readToWsOrPunctuator(ch);
+  if (pos > startPos)
+    addExport(startPos, pos, startPos, pos);
+  pos--;
+}
+
+// TypeScript: reads an import or export specifier up to the , or } after it,
+// returning whether it is marked type. Of those starting with type, type name
+// and type name as alias are, where type, type as name and type as as bind a
+// name type.
+bool readTypeSpecifier () {
+  bool typeFirst = false;
+  uint32_t words = 0;
+  char16_t ch = commentWhitespace(true);
+  // past four words it is not a specifier at all
+  while (pos < end && ch != ',' && ch != '}' && words < 5) {
+    char16_t* wordStart = pos;
+    if (isQuote(ch)) {
+      stringLiteral(ch);
+      pos++;
+    }
+    else {
+      readToWsOrPunctuator(ch);
+      if (pos == wordStart)
+        pos++;
+    }
+    if (words++ == 0)
+      typeFirst = pos - wordStart == 4 && matchesType(wordStart);
+    ch = commentWhitespace(true);
+  }
+  return typeFirst && (words == 2 || words == 4);
+}
+
 char16_t readExportAs (char16_t* startPos, char16_t* endPos) {
   char16_t ch = *pos;
   char16_t* localStartPos = startPos == endPos ? NULL : startPos;
@@ -675,7 +963,7 @@ void readImportString (const char16_t* ss, char16_t ch, int phase_keyword) {
   }
   pos++;
   ch = commentWhitespace(false);
-  if (!(ch == 'a' && memcmp(pos + 1, &SSERT[0], 5 * 2) == 0) && !(ch == 'w' && *(pos + 1) == 'i' && *(pos + 2) == 't' && *(pos + 3) == 'h')) {
+  if (!matchesAssert(pos) && !matchesWith(pos)) {
     pos--;
     return;
   }
@@ -738,6 +1026,10 @@ void readImportString (const char16_t* ss, char16_t ch, int phase_keyword) {
 }
 
 char16_t commentWhitespace (bool br) {
+  // keywords are skipped by their length, which on a truncated source can
+  // leave pos beyond the null terminator
+  if (pos > end + 1)
+    pos = end + 1;
   char16_t ch;
   do {
     ch = *pos;
@@ -749,6 +1041,10 @@ char16_t commentWhitespace (bool br) {
         blockComment(br);
       else
         return ch;
+      // a comment running to the end leaves pos just past it, where the
+      // increment below would read beyond the source
+      if (pos > end)
+        return ch;
     }
     else if (br ? !isBrOrWs(ch) : !isWsNotBr(ch)) {
       return ch;
@@ -758,51 +1054,65 @@ char16_t commentWhitespace (bool br) {
 }
 
 void templateString () {
+  STAT_SPAN(start);
   while (pos++ < end) {
     char16_t ch = *pos;
     if (ch == '$' && *(pos + 1) == '{') {
       pos++;
       openTokenStack[openTokenDepth].token = TemplateBrace;
+      openTokenStack[openTokenDepth].keyword = NoKeyword;
       openTokenStack[openTokenDepth++].pos = pos;
+      STAT_MAX(max_open_token_depth, openTokenDepth);
+      STAT_SPAN_END(template_units, start);
       return;
     }
     if (ch == '`') {
-      if (openTokenStack[--openTokenDepth].token != Template)
+      openTokenDepth--;
+      if (OPEN_TOKEN(openTokenDepth, IsTemplate)->token != Template)
         syntaxError();
+      STAT_SPAN_END(template_units, start);
       return;
     }
     if (ch == '\\')
       pos++;
   }
+  STAT_SPAN_END(template_units, start);
   syntaxError();
 }
 
 void blockComment (bool br) {
+  STAT_SPAN(start);
   pos++;
   while (pos++ < end) {
     char16_t ch = *pos;
     if (!br && isBr(ch))
-      return;
+      break;
     if (ch == '*' && *(pos + 1) == '/') {
       pos++;
-      return;
+      break;
     }
   }
+  STAT_SPAN_END(comment_units, start);
 }
 
 void lineComment () {
+  STAT_SPAN(start);
   while (pos++ < end) {
     char16_t ch = *pos;
     if (ch == '\n' || ch == '\r')
-      return;
+      break;
   }
+  STAT_SPAN_END(comment_units, start);
 }
 
 void stringLiteral (char16_t quote) {
+  STAT_SPAN(start);
   while (pos++ < end) {
     char16_t ch = *pos;
-    if (ch == quote)
+    if (ch == quote) {
+      STAT_SPAN_END(string_units, start);
       return;
+    }
     if (ch == '\\') {
       ch = *++pos;
       if (ch == '\r' && *(pos + 1) == '\n')
@@ -811,6 +1121,7 @@ void stringLiteral (char16_t quote) {
     else if (isBr(ch))
       break;
   }
+  STAT_SPAN_END(string_units, start);
   syntaxError();
 }
 
@@ -829,10 +1140,13 @@ char16_t regexCharacterClass () {
 }
 
 void regularExpression () {
+  STAT_SPAN(start);
   while (pos++ < end) {
     char16_t ch = *pos;
-    if (ch == '/')
+    if (ch == '/') {
+      STAT_SPAN_END(regex_units, start);
       return;
+    }
     if (ch == '[')
       ch = regexCharacterClass();
     else if (ch == '\\')
@@ -840,14 +1154,14 @@ void regularExpression () {
     else if (ch == '\n' || ch == '\r')
       break;
   }
+  STAT_SPAN_END(regex_units, start);
   syntaxError();
 }
 
 char16_t readToWsOrPunctuator (char16_t ch) {
-  do {
-    if (isBrOrWs(ch) || isPunctuator(ch))
-      return ch;
-  } while (ch = *(++pos));
+  // stops at the null terminator, including when starting on it
+  while (ch && !isBrOrWs(ch) && !isPunctuator(ch))
+    ch = *(++pos);
   return ch;
 }
 
@@ -858,173 +1172,201 @@ bool isBr (char16_t c) {
 }
 
 bool isWsNotBr (char16_t c) {
-  return c == 9 || c == 11 || c == 12 || c == 32 || c == 160;
+  return c < 128 ? CHAR_CLASS[c] & CharWsNotBr : c == 160;
 }
 
 bool isBrOrWs (char16_t c) {
-  return c > 8 && c < 14 || c == 32 || c == 160;
+  return c < 128 ? CHAR_CLASS[c] & CharBrOrWs : c == 160;
 }
 
 bool isBrOrWsOrPunctuatorNotDot (char16_t c) {
-  return c > 8 && c < 14 || c == 32 || c == 160 || isPunctuator(c) && c != '.';
+  return c < 128 ? CHAR_CLASS[c] & CharBrOrWsOrPunctuatorNotDot : c == 160;
 }
 
 bool isBrOrWsOrPunctuatorOrSpreadNotDot (char16_t* c) {
-  return *c > 8 && *c < 14 || *c == 32 || *c == 160 || isPunctuator(*c) && (isSpread(c) || *c != '.');
+  return isBrOrWsOrPunctuatorNotDot(*c) || isSpread(c);
+}
+
+bool isIdentifierChar (char16_t c) {
+  return c < 128 ? CHAR_CLASS[c] & CharIdentifier : c != 160;
 }
 
 bool isSpread (char16_t* c) {
-  return *c == '.' && *(c - 1) == '.' && *(c - 2) == '.';
+  return *c == '.' && c - 2 >= source && *(c - 1) == '.' && *(c - 2) == '.';
 }
 
 bool isQuote (char16_t ch) {
   return ch == '\'' || ch == '"';
 }
 
-bool keywordStart (char16_t* pos) {
-  return pos == source || isBrOrWsOrPunctuatorOrSpreadNotDot(pos - 1);
-}
-
-bool readPrecedingKeyword1 (char16_t* pos, char16_t c1) {
-  if (pos < source) return false;
-  return *pos == c1 && (pos == source || isBrOrWsOrPunctuatorNotDot(*(pos - 1)));
+// the character before pos in the source, or the null terminator at its start
+char16_t charBefore (const char16_t* pos) {
+  return pos > source ? *(pos - 1) : '\0';
 }
 
-bool readPrecedingKeywordn (char16_t* pos, const char16_t* compare, size_t n) {
-  if (pos - n + 1 < source) return false;
-  return memcmp(pos - n + 1, compare, n * 2) == 0 && (pos - n + 1 == source || isBrOrWsOrPunctuatorOrSpreadNotDot(pos - n));
+bool keywordStart (char16_t* pos) {
+  return pos == source || isBrOrWsOrPunctuatorOrSpreadNotDot(pos - 1);
 }
 
-// Detects one of case, debugger, delete, do, else, in, instanceof, new,
-//   return, throw, typeof, void, yield ,await
-bool isExpressionKeyword (char16_t* pos) {
-  switch (*pos) {
-    case 'd':
-      switch (*(pos - 1)) {
-        case 'i':
-          // void
-          return readPrecedingKeywordn(pos - 2, &VO[0], 2);
-        case 'l':
-          // yield
-          return readPrecedingKeywordn(pos - 2, &YIE[0], 3);
-        default:
-          return false;
-      }
-    case 'e':
-      switch (*(pos - 1)) {
-        case 's':
-          switch (*(pos - 2)) {
-            case 'l':
-              // else
-              return readPrecedingKeyword1(pos - 3, 'e');
-            case 'a':
-              // case
-              return readPrecedingKeyword1(pos - 3, 'c');
-            default:
-              return false;
-          }
-        case 't':
-          // delete
-          return readPrecedingKeywordn(pos - 2, &DELE[0], 4);
-        case 'u':
-          // continue
-          return readPrecedingKeywordn(pos - 2, &CONTIN[0], 6);
-        default:
-          return false;
-      }
-    case 'f':
-      if (*(pos - 1) != 'o' || *(pos - 2) != 'e')
-        return false;
-      switch (*(pos - 3)) {
-        case 'c':
-          // instanceof
-          return readPrecedingKeywordn(pos - 4, &INSTAN[0], 6);
-        case 'p':
-          // typeof
-          return readPrecedingKeywordn(pos - 4, &TY[0], 2);
-        default:
-          return false;
-      }
-    case 'k':
-      // break
-      return readPrecedingKeywordn(pos - 1, &BREA[0], 4);
-    case 'n':
-      // in, return
-      return readPrecedingKeyword1(pos - 1, 'i') || readPrecedingKeywordn(pos - 1, &RETUR[0], 5);
-    case 'o':
-      // do
-      return readPrecedingKeyword1(pos - 1, 'd');
-    case 'r':
-      // debugger
-      return readPrecedingKeywordn(pos - 1, &DEBUGGE[0], 7);
-    case 't':
-      // await
-      return readPrecedingKeywordn(pos - 1, &AWAI[0], 4);
-    case 'w':
-      switch (*(pos - 1)) {
-        case 'e':
-          // new
-          return readPrecedingKeyword1(pos - 2, 'n');
-        case 'o':
-          // throw
-          return readPrecedingKeywordn(pos - 2, &THR[0], 3);
-        default:
-          return false;
-      }
+// TypeScript: follows type arguments directly after a name, as in f<T> or
+// Map<K, V[]>, given the first character of each token. Anything but names,
+// literals and , . [ ] | & within them, such as && or ||, makes them a
+// comparison instead.
+void readTypeArguments (char16_t ch) {
+  if (ch == '<') {
+    if (typeArgumentsDepth > 0 || lastTokenPos == pos - 1 && isIdentifierChar(*lastTokenPos) && !isExpressionKeyword(lastTokenPos))
+      typeArgumentsDepth++;
+  }
+  else if (typeArgumentsDepth > 0) {
+    if (ch == '>') {
+      if (--typeArgumentsDepth == 0)
+        typeArgumentsEnd = pos;
+    }
+    else if ((ch == '|' || ch == '&') && *(pos + 1) == ch || !isIdentifierChar(ch) && !isQuote(ch) &&
+        ch != ',' && ch != '.' && ch != '[' && ch != ']' && ch != '|' && ch != '&') {
+      typeArgumentsDepth = 0;
+    }
   }
-  return false;
 }
 
-bool isParenKeyword (char16_t* curPos) {
-  return readPrecedingKeywordn(curPos, &WHILE[0], 5) ||
-      readPrecedingKeywordn(curPos, &FOR[0], 3) ||
-      readPrecedingKeywordn(curPos, &IF[0], 2);
+bool isParenKeyword (OpenToken* token) {
+  return token->keyword == If || token->keyword == For || token->keyword == While;
 }
 
 bool isPunctuator (char16_t ch) {
   // 23 possible punctuator endings: !%&()*+,-./:;<=>?[]^{}|~
-  return ch == '!' || ch == '%' || ch == '&' ||
-    ch > 39 && ch < 48 || ch > 57 && ch < 64 ||
-    ch == '[' || ch == ']' || ch == '^' ||
-    ch > 122 && ch < 127;
+  return ch < 128 && CHAR_CLASS[ch] & CharPunctuator;
 }
 
 bool isExpressionPunctuator (char16_t ch) {
   // 20 possible expression endings: !%&(*+,-.:;<=>?[^{|~
-  return ch == '!' || ch == '%' || ch == '&' ||
-    ch > 39 && ch < 47 && ch != 41 || ch > 57 && ch < 64 ||
-    ch == '[' || ch == '^' || ch > 122 && ch < 127 && ch != '}';
+  return ch < 128 && CHAR_CLASS[ch] & CharExpressionPunctuator;
 }
 
-bool isBreakOrContinue (char16_t* curPos) {
-  switch (*curPos) {
-    case 'k':
-      return readPrecedingKeywordn(curPos - 1, &BREA[0], 4);
-    case 'e':
-      if (*(curPos - 1) == 'u')
-        return readPrecedingKeywordn(curPos - 2, &CONTIN[0], 6);
+bool isBreakLabelStart (char16_t* curPos) {
+  STAT_ADD(keyword_lookbacks, 1);
+  if (!isBreakOrContinue(lastTokenPos) || isBrOrWsOrPunctuatorNotDot(*curPos) || isQuote(*curPos) || *curPos == '`')
+    return false;
+  STAT_ADD(label_gap_units, curPos - lastTokenPos - 1);
+  STAT_MAX(max_label_gap, (uint32_t)(curPos - lastTokenPos - 1));
+  // only whitespace without line breaks between the keyword and the label
+  for (char16_t* gapPos = lastTokenPos + 1; gapPos < curPos; gapPos++) {
+    if (!isWsNotBr(*gapPos))
+      return false;
   }
-  return false;
+  return true;
 }
 
-bool isExpressionTerminator (char16_t* curPos) {
+// Division / regex ambiguity handling based on checking:
+// - what token came previously (lastToken)
+// - if a closing brace or paren, what token came before the corresponding
+//   opening brace or paren (recorded as its keyword when it was pushed)
+// - whether the last token was the label of a break or continue
+enum SlashRule slashRule () {
+  char16_t lastToken = *lastTokenPos;
+  // TypeScript: a non-null assertion (a! / b) or type arguments (f<T> / b)
+  // end an expression, unlike a ! or > punctuator
+  if (typescript) {
+    if (lastToken == '!' && (charBefore(lastTokenPos) == ')' || charBefore(lastTokenPos) == ']' ||
+        isIdentifierChar(charBefore(lastTokenPos)) && !isExpressionKeyword(lastTokenPos - 1)))
+      return Division;
+    if (lastToken == '>' && lastTokenPos == typeArgumentsEnd)
+      return Division;
+  }
+  if (isExpressionPunctuator(lastToken) &&
+      !(lastToken == '.' && (charBefore(lastTokenPos) >= '0' && charBefore(lastTokenPos) <= '9')) &&
+      !(lastToken == '+' && charBefore(lastTokenPos) == '+') && !(lastToken == '-' && charBefore(lastTokenPos) == '-'))
+    return AfterPunctuator;
+  if (lastToken == ')' && isParenKeyword(OPEN_TOKEN(openTokenDepth, IsParenKeyword)))
+    return AfterParenKeyword;
+  if (lastToken == 'f' && charBefore(lastTokenPos) == 'o' && openTokenDepth > 0) {
+    OpenToken* enclosing = OPEN_TOKEN(openTokenDepth - 1, IsForParen);
+    if (enclosing->token == AnyParen && enclosing->keyword == For)
+      return AfterForOf;
+  }
+  if (lastToken == '}') {
+    OpenToken* closed = OPEN_TOKEN(openTokenDepth, IsStatementBrace);
+    if (isExpressionTerminator(closed) || closed->token == ClassBrace)
+      return AfterStatementBrace;
+  }
+  STAT_ADD(keyword_lookbacks, 1);
+  if (isExpressionKeyword(lastTokenPos))
+    return AfterKeyword;
+  if (lastToken == '/' && lastSlashWasDivision)
+    return AfterDivision;
+  if (!lastToken)
+    return AtStart;
+  // export default /some-regexp/
+  if (export_write_head != NULL && lastTokenPos >= export_write_head->start && lastTokenPos <= export_write_head->end)
+    return InExportDefault;
+  // Final check - if the last token was "break x" or "continue x"
+  if (lastTokenPos == breakLabelEnd)
+    return AfterBreakLabel;
+  return Division;
+}
+
+bool isExpressionTerminator (OpenToken* token) {
   // detects:
   // => ; ) finally catch else class X
   // as all of these followed by a { will indicate a statement brace
-  switch (*curPos) {
+  switch (*token->pos) {
     case '>':
-      return *(curPos - 1) == '=';
+      return charBefore(token->pos) == '=';
     case ';':
     case ')':
       return true;
-    case 'h':
-      return readPrecedingKeywordn(curPos - 1, &CATC[0], 4);
-    case 'y':
-      return readPrecedingKeywordn(curPos - 1, &FINALL[0], 6);
-    case 'e':
-      return readPrecedingKeywordn(curPos - 1, &ELS[0], 3);
   }
-  return false;
+  return token->keyword == Catch || token->keyword == Finally || token->keyword == Else;
+}
+
+// An import or export statement that ran into the end of the lexed range may
+// have been cut off by the work budget even when it parsed, since its
+// attributes or declaration can continue past the end. Its records can also
+// have been read past the end, as for import.meta, and attribute parsing
+// backtracks after errors, so those are checked as well.
+void endStatement (char16_t* statementStart) {
+  if (cutStatementStart != NULL)
+    return;
+  if (pos >= end || budgetExceeded ||
+      import_write_head != NULL && import_write_head->end > end + 1 ||
+      export_write_head != NULL && export_write_head->end > end + 1)
+    cutStatementStart = statementStart;
+}
+
+// Drops the records of the statement that was cut off by the budget, and of
+// any after it, keeping only the statements that completed within the lexed range
+void trimToBudget () {
+  const char16_t* cutStart = cutStatementStart != NULL ? cutStatementStart : end + 1;
+  // dynamic imports still open at the end were cut off, from the outermost one
+  if (dynamicImportStackDepth > 0 && dynamicImportStack[0]->statement_start < cutStart)
+    cutStart = dynamicImportStack[0]->statement_start;
+  // as was one closed by the last token, which a { past the end would make a method
+  Import* last = import_write_head;
+  if (last != NULL && last->dynamic != STANDARD_IMPORT && last->dynamic != IMPORT_META &&
+      last->statement_end == lastTokenPos + 1 && last->statement_start < cutStart)
+    cutStart = last->statement_start;
+
+  Import* import = first_import;
+  Import* last_import = NULL;
+  while (import != NULL && import->statement_start < cutStart) {
+    last_import = import;
+    import = import->next;
+  }
+  if (last_import == NULL)
+    first_import = NULL;
+  else
+    last_import->next = NULL;
+
+  Export* export = first_export;
+  Export* last_export = NULL;
+  while (export != NULL && export->start < cutStart) {
+    last_export = export;
+    export = export->next;
+  }
+  if (last_export == NULL)
+    first_export = NULL;
+  else
+    last_export->next = NULL;
 }
 
 void bail (uint32_t error) {
@@ -1034,7 +1376,313 @@ void bail (uint32_t error) {
 }
 
 void syntaxError () {
+  // callers can scan on past an error before returning, so the first one is
+  // kept rather than a position beyond the source
+  if (has_error) {
+    pos = end + 1;
+    return;
+  }
+  // running into the budget limit is reported separately from syntax errors
+  if (pos >= end && end != source + sourceLen - 1)
+    budgetExceeded = true;
   has_error = true;
   parse_error = pos - source;
   pos = end + 1;
 }
+
+// parseHtml
+// Lexes the module scripts of an HTML source in place: each script is lexed as
+// a source of its own between its tags, with the records read as offsets into
+// the HTML. Import maps are only located. Scripts are found as the HTML
+// tokenizer would, skipping comments and the content of the other raw text
+// elements, but character references in attribute values are not decoded.
+bool ph () {
+  const char16_t* htmlEnd = source + sourceLen;
+  const char16_t* p = source;
+  // the first script with an error, for e
+  Script* failed = NULL;
+  while (p < htmlEnd) {
+    if (*p != '<') {
+      p++;
+      continue;
+    }
+    const char16_t* tagStart = p++;
+    if (*p == '!' && *(p + 1) == '-' && *(p + 2) == '-') {
+      // comments, which <!--> and <!---> also end
+      p += 1;
+      while (p < htmlEnd && !(*p == '-' && *(p + 1) == '-' && (*(p + 2) == '>' || *(p + 2) == '!' && *(p + 3) == '>')))
+        p++;
+      while (p < htmlEnd && *p != '>')
+        p++;
+      p++;
+      continue;
+    }
+    if (*p == '!' || *p == '?' || *p == '/' && !isHtmlNameStart(*(p + 1))) {
+      // bogus comments, as <!DOCTYPE html>, and end tags without a name
+      while (p < htmlEnd && *p != '>')
+        p++;
+      p++;
+      continue;
+    }
+    if (*p == '/') {
+      p = htmlTagEnd(p + 1, htmlEnd);
+      continue;
+    }
+    if (!isHtmlNameStart(*p))
+      continue;
+
+    const char16_t* name = p;
+    while (p < htmlEnd && !isHtmlSpace(*p) && *p != '/' && *p != '>')
+      p++;
+    uint32_t nameLen = p - name;
+
+    if (nameLen != 6 || !matchesHtmlScript(name)) {
+      p = htmlTagEnd(name, htmlEnd);
+      if (nameLen == 9 && matchesHtmlPlaintext(name))
+        // everything after <plaintext> is text
+        break;
+      if (nameLen == 5 && (matchesHtmlStyle(name) || matchesHtmlTitle(name)) ||
+          nameLen == 3 && matchesHtmlXmp(name) ||
+          nameLen == 6 && matchesHtmlIframe(name) ||
+          nameLen == 7 && matchesHtmlNoembed(name) ||
+          nameLen == 8 && (matchesHtmlTextarea(name) || matchesHtmlNoframes(name) || matchesHtmlNoscript(name)))
+        // raw text, in which a <script> is no tag
+        p = rawTextEnd(p, htmlEnd, name, nameLen);
+      continue;
+    }
+
+    const char16_t* type = NULL;
+    const char16_t* typeEnd = NULL;
+    const char16_t* src = NULL;
+    const char16_t* srcEnd = NULL;
+    while (true) {
+      while (p < htmlEnd && (isHtmlSpace(*p) || *p == '/'))
+        p++;
+      if (p >= htmlEnd || *p == '>')
+        break;
+      const char16_t* attribute = p;
+      const char16_t* attributeEnd;
+      const char16_t* value;
+      const char16_t* valueEnd;
+      p = readHtmlAttribute(p, htmlEnd, &attributeEnd, &value, &valueEnd);
+      // the first of a repeated attribute applies, and one without a value is empty
+      if (value == NULL)
+        value = valueEnd = attributeEnd;
+      if (type == NULL && attributeEnd - attribute == 4 && matchesHtmlType(attribute)) {
+        type = value;
+        typeEnd = valueEnd;
+      }
+      else if (src == NULL && attributeEnd - attribute == 3 && matchesHtmlSrc(attribute)) {
+        src = value;
+        srcEnd = valueEnd;
+      }
+    }
+    // a tag cut off by the end of the source is dropped
+    if (p >= htmlEnd)
+      break;
+    p++;
+
+    const char16_t* contentEnd = scriptDataEnd(p, htmlEnd);
+    const char16_t* scriptEnd = contentEnd < htmlEnd ? htmlTagEnd(contentEnd + 2, htmlEnd) : htmlEnd;
+    enum ScriptType scriptType = type == NULL ? OtherScript : readScriptType(type, typeEnd);
+    if (scriptType != OtherScript) {
+      Script* script = (Script*)allocateAnalysis(sizeof(Script));
+      if (script_write_head == NULL)
+        first_script = script;
+      else
+        script_write_head->next = script;
+      script_write_head = script;
+      script->start = tagStart;
+      script->end = scriptEnd;
+      script->content_start = p;
+      script->content_end = contentEnd;
+      script->src_start = src;
+      script->src_end = srcEnd;
+      script->type = scriptType;
+      script->import_count = 0;
+      script->export_count = 0;
+      script->facade = true;
+      script->has_module_syntax = false;
+      script->has_error = false;
+      script->parse_error = 0;
+      script->next = NULL;
+      // the content of a script with a src is never run
+      if (scriptType == ModuleScript && src == NULL) {
+        lexScript(script);
+        if (script->has_error && failed == NULL)
+          failed = script;
+      }
+    }
+    p = scriptEnd;
+  }
+  parse_error = failed == NULL ? 0 : failed->parse_error;
+  return failed == NULL;
+}
+
+bool isHtmlSpace (char16_t ch) {
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\f' || ch == '\r';
+}
+
+bool isHtmlNameStart (char16_t ch) {
+  return ch >= 'a' && ch <= 'z' || ch >= 'A' && ch <= 'Z';
+}
+
+// reads the attribute at p up to the start of the next one, setting value to
+// NULL for an attribute without one
+const char16_t* readHtmlAttribute (const char16_t* p, const char16_t* htmlEnd, const char16_t** nameEnd, const char16_t** value, const char16_t** valueEnd) {
+  *value = NULL;
+  *valueEnd = NULL;
+  // a leading = is part of the name
+  p++;
+  while (p < htmlEnd && !isHtmlSpace(*p) && *p != '/' && *p != '>' && *p != '=')
+    p++;
+  *nameEnd = p;
+  while (p < htmlEnd && isHtmlSpace(*p))
+    p++;
+  if (p >= htmlEnd || *p != '=')
+    return *nameEnd;
+  p++;
+  while (p < htmlEnd && isHtmlSpace(*p))
+    p++;
+  if (p < htmlEnd && (*p == '"' || *p == '\'')) {
+    char16_t quote = *p++;
+    *value = p;
+    while (p < htmlEnd && *p != quote)
+      p++;
+    *valueEnd = p;
+    return p < htmlEnd ? p + 1 : p;
+  }
+  *value = p;
+  while (p < htmlEnd && !isHtmlSpace(*p) && *p != '>')
+    p++;
+  *valueEnd = p;
+  return p;
+}
+
+// the end of the tag whose name starts at p, after its >, or the end of the source
+const char16_t* htmlTagEnd (const char16_t* p, const char16_t* htmlEnd) {
+  while (p < htmlEnd && !isHtmlSpace(*p) && *p != '/' && *p != '>')
+    p++;
+  while (true) {
+    while (p < htmlEnd && (isHtmlSpace(*p) || *p == '/'))
+      p++;
+    if (p >= htmlEnd)
+      return htmlEnd;
+    if (*p == '>')
+      return p + 1;
+    const char16_t* nameEnd;
+    const char16_t* value;
+    const char16_t* valueEnd;
+    p = readHtmlAttribute(p, htmlEnd, &nameEnd, &value, &valueEnd);
+  }
+}
+
+// whether p starts a script tag name, ending in a space, / or >
+bool isScriptTagName (const char16_t* p, const char16_t* htmlEnd) {
+  return htmlEnd - p > 6 && matchesHtmlScript(p) && (isHtmlSpace(p[6]) || p[6] == '/' || p[6] == '>');
+}
+
+// the < of the end tag of the raw text element named name, or the end of the source
+const char16_t* rawTextEnd (const char16_t* p, const char16_t* htmlEnd, const char16_t* name, uint32_t nameLen) {
+  for (; p < htmlEnd; p++) {
+    if (*p != '<' || *(p + 1) != '/' || htmlEnd - p <= 2 + nameLen)
+      continue;
+    uint32_t i = 0;
+    while (i < nameLen && (p[2 + i] | 0x20) == (name[i] | 0x20))
+      i++;
+    char16_t next = p[2 + nameLen];
+    if (i == nameLen && (isHtmlSpace(next) || next == '/' || next == '>'))
+      return p;
+  }
+  return htmlEnd;
+}
+
+// the < of the </script> ending the script content at p, or the end of the
+// source. As in the escape states of the tokenizer, a <script> within <!-- -->
+// is taken to open another script, whose </script> does not end this one.
+const char16_t* scriptDataEnd (const char16_t* p, const char16_t* htmlEnd) {
+  bool escaped = false;
+  bool doubleEscaped = false;
+  for (; p < htmlEnd; p++) {
+    if (*p == '<') {
+      if (*(p + 1) == '/' && isScriptTagName(p + 2, htmlEnd)) {
+        if (!doubleEscaped)
+          return p;
+        doubleEscaped = false;
+      }
+      else if (!escaped && *(p + 1) == '!' && *(p + 2) == '-' && *(p + 3) == '-') {
+        escaped = true;
+        // the dashes of <!-- also count towards -->
+        p++;
+      }
+      else if (escaped && isScriptTagName(p + 1, htmlEnd)) {
+        doubleEscaped = true;
+      }
+    }
+    else if (escaped && *p == '-' && *(p + 1) == '-' && *(p + 2) == '>') {
+      escaped = false;
+      doubleEscaped = false;
+      p += 2;
+    }
+  }
+  return htmlEnd;
+}
+
+// module or importmap, in any case and with surrounding spaces
+enum ScriptType readScriptType (const char16_t* value, const char16_t* valueEnd) {
+  while (value < valueEnd && isHtmlSpace(*value))
+    value++;
+  while (valueEnd > value && isHtmlSpace(*(valueEnd - 1)))
+    valueEnd--;
+  if (valueEnd - value == 6 && matchesHtmlModule(value))
+    return ModuleScript;
+  if (valueEnd - value == 9 && matchesHtmlImportmap(value))
+    return ImportMapScript;
+  return OtherScript;
+}
+
+// lexes a module script as a source ending at its end tag, keeping the
+// records only if it lexes without errors
+void lexScript (Script* script) {
+  const char16_t* html = source;
+  uint32_t htmlLen = sourceLen;
+  Import* lastImport = import_write_head;
+  Import* lastImportLast = import_write_head_last;
+  Export* lastExport = export_write_head;
+  void* lastAnalysisHead = analysis_head;
+
+  // the end tag stands in for the null terminator of the source meanwhile
+  char16_t* contentEnd = (char16_t*)script->content_end;
+  char16_t terminator = *contentEnd;
+  *contentEnd = '\0';
+  source = script->content_start;
+  sourceLen = contentEnd - script->content_start;
+  bool success = parse();
+  *contentEnd = terminator;
+  source = html;
+  sourceLen = htmlLen;
+
+  script->facade = facade;
+  script->has_module_syntax = hasModuleSyntax;
+  if (!success) {
+    script->has_error = true;
+    script->parse_error = script->content_start - html + parse_error;
+    import_write_head = lastImport;
+    import_write_head_last = lastImportLast;
+    if (lastImport == NULL)
+      first_import = NULL;
+    else
+      lastImport->next = NULL;
+    export_write_head = lastExport;
+    if (lastExport == NULL)
+      first_export = NULL;
+    else
+      lastExport->next = NULL;
+    analysis_head = lastAnalysisHead;
+    return;
+  }
+  for (Import* import = lastImport == NULL ? first_import : lastImport->next; import != NULL; import = import->next)
+    script->import_count++;
+  for (Export* export = lastExport == NULL ? first_export : lastExport->next; export != NULL; export = export->next)
+    script->export_count++;
+}
@@ -1,15 +1,25 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+#endif
 
 typedef unsigned short char16_t;
 extern unsigned char __heap_base;
 
+#ifdef LEXER_THREADS
+// every thread of a parallel parse lexes with a state of its own, see parallel.c
+#define THREAD_LOCAL _Thread_local
+#else
+#define THREAD_LOCAL
+#endif
+
 const char16_t* STANDARD_IMPORT = (char16_t*)0x1;
 const char16_t* IMPORT_META = (char16_t*)0x2;
 const char16_t __empty_char = '\0';
 const char16_t* EMPTY_CHAR = &__empty_char;
-const char16_t* source = (void*)&__heap_base;
+THREAD_LOCAL const char16_t* source = (void*)&__heap_base;
 
 void setSource (void* ptr) {
   source = ptr;
@@ -34,12 +44,15 @@ struct Import {
   const char16_t* dynamic;
   bool safe;
   enum ImportType import_ty;
+  // TypeScript elides the import, see pt
+  bool type_only;
   struct Import* next;
 };
 typedef struct Import Import;
 
 // Paren = odd, Brace = even
 enum OpenTokenState {
+  Unset = 0, // never pushed, see parallel.c
   AnyParen = 1, // (
   AnyBrace = 2, // {
   Template = 3, // `
@@ -49,8 +62,22 @@ enum OpenTokenState {
   AsyncParen = 7, // async()
 };
 
+// keyword preceding an open token, recorded when it is pushed
+enum OpenTokenKeyword {
+  NoKeyword = 0,
+  If = 1, // if (
+  For = 2, // for (
+  While = 3, // while (
+  Catch = 4, // catch {
+  Finally = 5, // finally {
+  Else = 6, // else {
+};
+
+// the state and keyword are stored as bytes, keeping an entry at 8 bytes in
+// the wasm build so the token stack still fits the 13312 byte stack
 struct OpenToken {
-  enum OpenTokenState token;
+  uint8_t token; // enum OpenTokenState
+  uint8_t keyword; // enum OpenTokenKeyword
   char16_t* pos;
 };
 typedef struct OpenToken OpenToken;
@@ -60,48 +87,200 @@ struct Export {
   const char16_t* end;
   const char16_t* local_start;
   const char16_t* local_end;
+  // TypeScript elides the export, see pt
+  bool type_only;
   struct Export* next;
 };
 typedef struct Export Export;
 
-Import* first_import = NULL;
-Export* first_export = NULL;
-Import* import_read_head = NULL;
-Export* export_read_head = NULL;
-Import* import_write_head = NULL;
-Import* import_write_head_last = NULL;
-Export* export_write_head = NULL;
-void* analysis_base;
-void* analysis_head;
-
-bool facade;
-bool hasModuleSyntax;
-bool lastSlashWasDivision;
-uint16_t openTokenDepth;
-char16_t* lastTokenPos;
-char16_t* pos;
-char16_t* end;
-OpenToken* openTokenStack;
-uint16_t dynamicImportStackDepth;
-Import** dynamicImportStack;
-bool nextBraceIsClass;
+enum ScriptType {
+  OtherScript = 0, // classic scripts and data blocks, which are skipped
+  ModuleScript = 1,
+  ImportMapScript = 2,
+};
+
+// a module script or import map of an HTML source, see ph
+struct Script {
+  const char16_t* start; // <script
+  const char16_t* end; // after </script>, or the end of the source
+  const char16_t* content_start;
+  const char16_t* content_end;
+  const char16_t* src_start;
+  const char16_t* src_end;
+  enum ScriptType type;
+  // the records of a module script follow those of the scripts before it
+  uint32_t import_count;
+  uint32_t export_count;
+  bool facade;
+  bool has_module_syntax;
+  bool has_error;
+  uint32_t parse_error;
+  struct Script* next;
+};
+typedef struct Script Script;
+
+THREAD_LOCAL Import* first_import = NULL;
+THREAD_LOCAL Export* first_export = NULL;
+THREAD_LOCAL Import* import_read_head = NULL;
+THREAD_LOCAL Export* export_read_head = NULL;
+THREAD_LOCAL Import* import_write_head = NULL;
+THREAD_LOCAL Import* import_write_head_last = NULL;
+THREAD_LOCAL Export* export_write_head = NULL;
+THREAD_LOCAL Script* first_script = NULL;
+THREAD_LOCAL Script* script_write_head = NULL;
+THREAD_LOCAL void* analysis_base;
+THREAD_LOCAL void* analysis_head;
+
+THREAD_LOCAL bool facade;
+THREAD_LOCAL bool hasModuleSyntax;
+THREAD_LOCAL bool detectOnly = false;
+// TypeScript syntax, see pt
+THREAD_LOCAL bool typescript = false;
+// records added meanwhile are type-only, reset by each import or export
+// statement before reading it
+THREAD_LOCAL bool typeOnly = false;
+// TypeScript: depth of the type arguments being read, and the > closing the
+// last ones, see readTypeArguments
+THREAD_LOCAL uint16_t typeArgumentsDepth;
+THREAD_LOCAL char16_t* typeArgumentsEnd;
+THREAD_LOCAL bool lastSlashWasDivision;
+THREAD_LOCAL uint16_t openTokenDepth;
+THREAD_LOCAL char16_t* lastTokenPos;
+// end of the label of a preceding "break label" or "continue label"
+THREAD_LOCAL char16_t* breakLabelEnd;
+THREAD_LOCAL char16_t* pos;
+THREAD_LOCAL char16_t* end;
+THREAD_LOCAL OpenToken* openTokenStack;
+THREAD_LOCAL uint16_t dynamicImportStackDepth;
+THREAD_LOCAL Import** dynamicImportStack;
+THREAD_LOCAL bool nextBraceIsClass;
 
 // Memory Structure:
 // -> source
-// -> analysis starts after source
-uint32_t parse_error;
-bool has_error = false;
-uint32_t sourceLen = 0;
+// -> analysis starts after source, growing with the number of records
+THREAD_LOCAL uint32_t parse_error;
+THREAD_LOCAL bool has_error = false;
+THREAD_LOCAL uint32_t sourceLen = 0;
+// maximum number of source code units to lex, 0 for no limit
+THREAD_LOCAL uint32_t workBudget = 0;
+THREAD_LOCAL bool budgetExceeded = false;
+// start of the import or export statement that ran into the end of the budget
+THREAD_LOCAL char16_t* cutStatementStart = NULL;
+
+// the rule that decided whether a / starts a regular expression, in the order
+// they are checked
+enum SlashRule {
+  Division = 0,
+  AfterPunctuator = 1,
+  AfterParenKeyword = 2, // if (...) /
+  AfterForOf = 3, // for (x of /
+  AfterStatementBrace = 4, // } /
+  AfterKeyword = 5, // return /
+  AfterDivision = 6, // a / /
+  AtStart = 7,
+  InExportDefault = 8, // export default /
+  AfterBreakLabel = 9, // break label /
+};
+
+#ifdef LEXER_STATS
+// Hot-path counters of the instrumented build (-DLEXER_STATS), reset by every
+// allocateSource. Without it the STAT_ macros compile to nothing.
+struct Stats {
+  uint32_t string_units;
+  uint32_t comment_units;
+  uint32_t template_units;
+  uint32_t regex_units;
+  uint32_t slash_rules[10];
+  // backward reads from the last token: keyword lookups before ( { and /,
+  // and the whitespace between a break / continue and its label
+  uint32_t keyword_lookbacks;
+  uint32_t label_gap_units;
+  uint32_t max_label_gap;
+  uint32_t max_open_token_depth;
+  // dynamic imports dropped again when followed by { as a method
+  uint32_t retracted_dynamic_imports;
+};
+THREAD_LOCAL struct Stats stats;
+#define STAT_ADD(field, n) (stats.field += (n))
+#define STAT_MAX(field, n) (stats.field = (n) > stats.field ? (n) : stats.field)
+#define STAT_SPAN(start) const char16_t* start = pos
+#define STAT_SPAN_END(field, start) STAT_ADD(field, pos - start)
+
+// getStats
+struct Stats* st () {
+  return &stats;
+}
+#else
+#define STAT_ADD(field, n)
+#define STAT_MAX(field, n)
+#define STAT_SPAN(start)
+#define STAT_SPAN_END(field, start)
+#endif
+
+#ifdef LEXER_TRACE
+// USDT probes in the es_module_lexer provider (-DLEXER_TRACE, needs
+// <sys/sdt.h>), for perf, bpftrace or DTrace to attribute time per source.
+// Each probe marks the start of a phase, which lasts until the next probe:
+// copy, facade, mainparse, extract and done, where copy, extract and done
+// are fired by the embedder around parse. The arguments are the name of the
+// source, as set in traceName by the embedder, and its length in code units.
+#include <sys/sdt.h>
+THREAD_LOCAL const char* traceName = "@";
+#define TRACE(phase) DTRACE_PROBE2(es_module_lexer, phase, traceName, sourceLen)
+#else
+#define TRACE(phase)
+#endif
+
+#ifdef LEXER_THREADS
+// Parallel parsing (-DLEXER_THREADS, see parallel.c) lexes a source in chunks
+// on several threads. Every chunk but the first is lexed speculatively from
+// the main loop at its start, with the open tokens before it unknown: these
+// are left Unset below a base depth, and whatever the chunk decides about
+// them is recorded, to be checked once the chunks before it are stitched.
+struct Chunk;
+THREAD_LOCAL struct Chunk* chunk = NULL;
+// the main loop of a chunk stops at its first token at or after this
+THREAD_LOCAL char16_t* stopPos;
+
+// what a chunk assumed not to hold for an Unset open token
+enum OpenTokenRule {
+  IsImportParen = 0,
+  IsTemplateBrace = 1,
+  IsTemplate = 2,
+  IsParenKeyword = 3,
+  IsForParen = 4,
+  IsStatementBrace = 5,
+};
+
+bool beginChunk ();
+void reserveChunkAnalysis (size_t size);
+bool openTokensEmpty ();
+bool atTopLevel ();
+OpenToken* assumeOpenToken (uint16_t index, enum OpenTokenRule rule);
+
+// checked before popping an open token
+#define OPEN_TOKENS_EMPTY() openTokensEmpty()
+// checked before lexing an import or export statement
+#define AT_TOP_LEVEL() atTopLevel()
+// reads an open token to check rule on, which may be Unset in a chunk
+#define OPEN_TOKEN(index, rule) (openTokenStack[index].token == Unset ? assumeOpenToken(index, rule) : &openTokenStack[index])
+#else
+#define OPEN_TOKENS_EMPTY() (openTokenDepth == 0)
+#define AT_TOP_LEVEL() (openTokenDepth == 0)
+#define OPEN_TOKEN(index, rule) (&openTokenStack[index])
+#endif
 
 void bail (uint32_t err);
 
 // allocateSource
 const char16_t* sa (uint32_t utf16Len) {
   sourceLen = utf16Len;
+  workBudget = 0;
   const char16_t* sourceEnd = source + utf16Len + 1;
   // ensure source is null terminated
   *(char16_t*)(source + utf16Len) = '\0';
-  analysis_base = (void*)sourceEnd;
+  // records hold pointers, so the arena starts at the next 8-byte boundary
+  analysis_base = (void*)(((size_t)sourceEnd + 7) & ~(size_t)7);
   analysis_head = analysis_base;
   first_import = NULL;
   import_write_head = NULL;
@@ -109,12 +288,53 @@ const char16_t* sa (uint32_t utf16Len) {
   first_export = NULL;
   export_write_head = NULL;
   export_read_head = NULL;
+  first_script = NULL;
+  script_write_head = NULL;
+#ifdef LEXER_STATS
+  stats = (struct Stats){ 0 };
+#endif
   return source;
 }
 
+// widenSource
+// one-byte sources can be written by the JS wrapper into the upper half of the
+// source space, from where the first len code units are widened in place
+void sw (uint32_t len) {
+  const uint8_t* in = (const uint8_t*)source + sourceLen;
+  char16_t* out = (char16_t*)source;
+  uint32_t i = 0;
+#ifdef __wasm_simd128__
+  // the output never catches up with the input, so each vector is loaded
+  // before any unread input is overwritten
+  for (; i + 16 <= len; i += 16) {
+    v128_t bytes = wasm_v128_load(in + i);
+    wasm_v128_store(out + i, wasm_u16x8_extend_low_u8x16(bytes));
+    wasm_v128_store(out + i + 8, wasm_u16x8_extend_high_u8x16(bytes));
+  }
+#endif
+  for (; i < len; i++)
+    out[i] = in[i];
+}
+
+// the analysis arena starts right after the source, and in the wasm build only
+// grows memory as records are added instead of reserving space up front
+void* allocateAnalysis (size_t size) {
+#ifdef LEXER_THREADS
+  if (chunk != NULL)
+    reserveChunkAnalysis(size);
+#endif
+  void* ptr = analysis_head;
+  analysis_head = analysis_head + size;
+#ifdef __wasi__
+  size_t memEnd = __builtin_wasm_memory_size(0) * 65536;
+  if ((size_t)analysis_head > memEnd)
+    __builtin_wasm_memory_grow(0, ((size_t)analysis_head - memEnd + 65535) / 65536);
+#endif
+  return ptr;
+}
+
 void addImport (const char16_t* statement_start, const char16_t* start, const char16_t* end, const char16_t* dynamic) {
-  Import* import = (Import*)(analysis_head);
-  analysis_head = analysis_head + sizeof(Import);
+  Import* import = (Import*)allocateAnalysis(sizeof(Import));
   if (import_write_head == NULL)
     first_import = import;
   else
@@ -139,14 +359,14 @@ void addImport (const char16_t* statement_start, const char16_t* start, const ch
   import->assert_index = 0;
   import->dynamic = dynamic;
   import->safe = dynamic == STANDARD_IMPORT;
+  import->type_only = typeOnly;
   import->next = NULL;
   if (dynamic == IMPORT_META || dynamic == STANDARD_IMPORT)
     hasModuleSyntax = true;
 }
 
 void addExport (const char16_t* start, const char16_t* end, const char16_t* local_start, const char16_t* local_end) {
-  Export* export = (Export*)(analysis_head);
-  analysis_head = analysis_head + sizeof(Export);
+  Export* export = (Export*)allocateAnalysis(sizeof(Export));
   if (export_write_head == NULL)
     first_export = export;
   else
@@ -156,14 +376,30 @@ void addExport (const char16_t* start, const char16_t* end, const char16_t* loca
   export->end = end;
   export->local_start = local_start;
   export->local_end = local_end;
+  export->type_only = typeOnly;
   export->next = NULL;
   hasModuleSyntax = true;
 }
 
+// setBudget
+void sb (uint32_t budget) {
+  workBudget = budget;
+}
+
+// getAnalysisUsed
+// bytes of import and export records written since the last allocateSource
+uint32_t au () {
+  return (char*)analysis_head - (char*)analysis_base;
+}
+
 // getErr
 uint32_t e () {
   return parse_error;
 }
+// getBudgetExceeded
+bool bx () {
+  return budgetExceeded;
+}
 
 // getImportStart
 uint32_t is () {
@@ -202,6 +438,10 @@ uint32_t id () {
 uint32_t ip () {
   return import_read_head->safe;
 }
+// getImportTypeOnly
+bool iy () {
+  return import_read_head->type_only;
+}
 // getExportStart
 uint32_t es () {
   return export_read_head->start - source;
@@ -218,6 +458,10 @@ int32_t els () {
 int32_t ele () {
   return export_read_head->local_end ? export_read_head->local_end - source : -1;
 }
+// getExportTypeOnly
+bool ey () {
+  return export_read_head->type_only;
+}
 // readImport
 bool ri () {
   if (import_read_head == NULL)
@@ -238,6 +482,76 @@ bool re () {
     return false;
   return true;
 }
+// writeColumns
+// writes the import and export counts followed by the import columns
+// (s, e, ss, se, d, a, t, ip) and export columns (s, e, ls, le) after the
+// analysis records, returning their 4-byte aligned address
+int32_t* wc () {
+  uint32_t importCount = 0;
+  for (Import* import = first_import; import != NULL; import = import->next)
+    importCount++;
+  uint32_t exportCount = 0;
+  for (Export* export = first_export; export != NULL; export = export->next)
+    exportCount++;
+
+  analysis_head = (void*)(((size_t)analysis_head + 3) & ~3);
+  int32_t* out = (int32_t*)allocateAnalysis((2 + importCount * 8 + exportCount * 4) * sizeof(int32_t));
+  out[0] = importCount;
+  out[1] = exportCount;
+
+  int32_t* column = out + 2;
+  import_read_head = NULL;
+  for (uint32_t i = 0; ri(); i++) {
+    column[i] = is();
+    column[importCount + i] = ie();
+    column[importCount * 2 + i] = ss();
+    column[importCount * 3 + i] = se();
+    column[importCount * 4 + i] = id();
+    column[importCount * 5 + i] = ai();
+    column[importCount * 6 + i] = it();
+    column[importCount * 7 + i] = ip();
+  }
+
+  column += importCount * 8;
+  export_read_head = NULL;
+  for (uint32_t i = 0; re(); i++) {
+    column[i] = es();
+    column[exportCount + i] = ee();
+    column[exportCount * 2 + i] = els();
+    column[exportCount * 3 + i] = ele();
+  }
+  return out;
+}
+// writeScripts
+// writes the script count followed by a row per script of the last ph, as
+// (t, ss, se, s, e, us, ue, ic, ec, f, ms, err) with -1 for no src or error,
+// returning its 4-byte aligned address
+int32_t* hw () {
+  uint32_t scriptCount = 0;
+  for (Script* script = first_script; script != NULL; script = script->next)
+    scriptCount++;
+
+  analysis_head = (void*)(((size_t)analysis_head + 3) & ~3);
+  int32_t* out = (int32_t*)allocateAnalysis((1 + scriptCount * 12) * sizeof(int32_t));
+  out[0] = scriptCount;
+
+  int32_t* row = out + 1;
+  for (Script* script = first_script; script != NULL; script = script->next, row += 12) {
+    row[0] = script->type;
+    row[1] = script->start - source;
+    row[2] = script->end - source;
+    row[3] = script->content_start - source;
+    row[4] = script->content_end - source;
+    row[5] = script->src_start ? script->src_start - source : -1;
+    row[6] = script->src_end ? script->src_end - source : -1;
+    row[7] = script->import_count;
+    row[8] = script->export_count;
+    row[9] = script->facade;
+    row[10] = script->has_module_syntax;
+    row[11] = script->has_error ? (int32_t)script->parse_error : -1;
+  }
+  return out;
+}
 bool f () {
   return facade;
 }
@@ -247,8 +561,41 @@ bool ms () {
 
 bool parse ();
 
+// detectModuleSyntax
+// parses only up to the first import / export statement that sets hasModuleSyntax
+bool md () {
+  detectOnly = true;
+  bool success = parse();
+  detectOnly = false;
+  return success;
+}
+
+// parseTypeScript
+// parses TypeScript, recording type-only imports and exports as such: import
+// type, export type, interfaces, declare and names marked type in braces,
+// along with / after a non-null assertion or type arguments being a division
+bool pt () {
+  typescript = true;
+  bool success = parse();
+  typescript = false;
+  return success;
+}
+
 void tryParseImportStatement ();
 void tryParseExportStatement ();
+void addDeclarationExport (char16_t ch);
+bool readTypeSpecifier ();
+void readTypeArguments (char16_t ch);
+
+bool isHtmlSpace (char16_t ch);
+bool isHtmlNameStart (char16_t ch);
+const char16_t* readHtmlAttribute (const char16_t* p, const char16_t* htmlEnd, const char16_t** nameEnd, const char16_t** value, const char16_t** valueEnd);
+const char16_t* htmlTagEnd (const char16_t* p, const char16_t* htmlEnd);
+bool isScriptTagName (const char16_t* p, const char16_t* htmlEnd);
+const char16_t* rawTextEnd (const char16_t* p, const char16_t* htmlEnd, const char16_t* name, uint32_t nameLen);
+const char16_t* scriptDataEnd (const char16_t* p, const char16_t* htmlEnd);
+enum ScriptType readScriptType (const char16_t* value, const char16_t* valueEnd);
+void lexScript (Script* script);
 
 void readImportString (const char16_t* ss, char16_t ch, int phase_keyword);
 char16_t readExportAs (char16_t* startPos, char16_t* endPos);
@@ -270,21 +617,27 @@ bool isBrOrWs (char16_t c);
 bool isBrOrWsOrPunctuator (char16_t c);
 bool isSpread (char16_t* c);
 bool isBrOrWsOrPunctuatorNotDot (char16_t c);
-
-bool readPrecedingKeyword1(char16_t* pos, char16_t c1);
-bool readPrecedingKeywordn(char16_t* pos, const char16_t* compare, size_t n);
+bool isIdentifierChar (char16_t c);
 
 bool isBreakOrContinue (char16_t* curPos);
+bool isBreakLabelStart (char16_t* curPos);
 
+char16_t charBefore (const char16_t* pos);
 bool keywordStart (char16_t* pos);
 bool isExpressionKeyword (char16_t* pos);
-bool isParenKeyword (char16_t* pos);
+enum OpenTokenKeyword readParenKeyword (char16_t* pos);
+enum OpenTokenKeyword readBraceKeyword (char16_t* pos);
+bool isParenKeyword (OpenToken* token);
 bool isPunctuator (char16_t charCode);
 bool isExpressionPunctuator (char16_t charCode);
-bool isExpressionTerminator (char16_t* pos);
+bool isExpressionTerminator (OpenToken* token);
+enum SlashRule slashRule ();
 
 void nextChar (char16_t ch);
 void nextCharSurrogate (char16_t ch);
 char16_t readChar ();
 
+void endStatement (char16_t* statementStart);
+void trimToBudget ();
+
 void syntaxError ();
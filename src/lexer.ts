@@ -104,6 +104,13 @@ export interface ImportSpecifier {
    * Otherwise this is `-1`.
    */
   readonly a: number;
+
+  /**
+   * Only given by `parseTypeScript`, whether the import is elided by
+   * TypeScript, as for `import type` or with every imported name marked
+   * `type`.
+   */
+  readonly typeOnly?: boolean;
 }
 
 export interface ExportSpecifier {
@@ -178,6 +185,13 @@ export interface ExportSpecifier {
    * End of local name, or -1.
    */
   readonly le: number;
+
+  /**
+   * Only given by `parseTypeScript`, whether the export is a type, as for
+   * `export type`, `export interface`, `export declare` or a name marked
+   * `type`.
+   */
+  readonly typeOnly?: boolean;
 }
 
 export interface ParseError extends Error {
@@ -186,84 +200,567 @@ export interface ParseError extends Error {
 
 const isLE = new Uint8Array(new Uint16Array([1]).buffer)[0] === 1;
 
+// Set to true by the build when LEXER_TRACE is set, otherwise the tracing
+// below is removed by the minifier
+const LEXER_TRACE: boolean = false;
+
+const encoder = typeof TextEncoder !== 'undefined' ? new TextEncoder() : undefined;
+// sources are transferred in chunks of this many code units as one-byte UTF-8
+const ONE_BYTE_CHUNK = 1 << 16;
+
 /**
  * Outputs the list of exports and locations of import specifiers,
  * including dynamic import and import meta handling.
  *
+ * When a work budget is provided, lexing stops after that many code units of
+ * the source. Instead of throwing, the imports and exports of the statements
+ * completed before that point are then returned with `budgetExceeded` set to true.
+ *
  * @param source Source code to parser
  * @param name Optional sourcename
+ * @param budget Optional maximum number of source code units to lex
  * @returns Tuple contaning imports list and exports list.
  */
-export function parse (source: string, name = '@'): readonly [
+export function parse (source: string, name = '@', budget = 0): readonly [
   imports: ReadonlyArray<ImportSpecifier>,
   exports: ReadonlyArray<ExportSpecifier>,
   facade: boolean,
-  hasModuleSyntax: boolean
+  hasModuleSyntax: boolean,
+  budgetExceeded: boolean
 ] {
-  if (!wasm)
+  if (!lexer && !initLazy())
     // actually returns a promise if init hasn't resolved (not type safe).
     // casting to avoid a breaking type change.
-    return init.then(() => parse(source)) as unknown as ReturnType<typeof parse>;
+    return init.then(() => parse(source, name, budget)) as unknown as ReturnType<typeof parse>;
+  return lexer.parse(source, name, budget);
+}
+
+/**
+ * Lexes TypeScript as `parse` does JavaScript, with the imports and exports
+ * that TypeScript elides given as `typeOnly`: `import type`, `export type`,
+ * `export interface`, `export declare` and names marked `type` in braces,
+ * with an import of only such names also type-only. A `/` after a non-null
+ * assertion or type arguments, as in `a! / b` or `f<T> / b`, is a division.
+ *
+ * @param source TypeScript source code to parse
+ * @param name Optional sourcename
+ * @param budget Optional maximum number of source code units to lex
+ * @returns Tuple contaning imports list and exports list.
+ */
+export function parseTypeScript (source: string, name = '@', budget = 0): ReturnType<typeof parse> {
+  if (!lexer && !initLazy())
+    // actually returns a promise if init hasn't resolved (not type safe).
+    return init.then(() => parseTypeScript(source, name, budget)) as unknown as ReturnType<typeof parse>;
+  return lexer.parseTypeScript(source, name, budget);
+}
+
+function decode (str: string | undefined) {
+  try {
+    return (0, eval)(str as string) // eval(undefined) -> undefined
+  }
+  catch (e) {}
+}
+
+export interface ImportColumns {
+  /** Start of module specifier, see `ImportSpecifier.s` */
+  readonly s: Int32Array;
+  /** End of module specifier, see `ImportSpecifier.e` */
+  readonly e: Int32Array;
+  /** Start of import statement, see `ImportSpecifier.ss` */
+  readonly ss: Int32Array;
+  /** End of import statement, see `ImportSpecifier.se` */
+  readonly se: Int32Array;
+  /** Dynamic import start, -1 for static imports and -2 for import.meta, see `ImportSpecifier.d` */
+  readonly d: Int32Array;
+  /** Import assertion start or -1, see `ImportSpecifier.a` */
+  readonly a: Int32Array;
+  /** Type of import statement, see `ImportSpecifier.t` */
+  readonly t: Int32Array;
+}
+
+export interface ExportColumns {
+  /** Start of exported name, see `ExportSpecifier.s` */
+  readonly s: Int32Array;
+  /** End of exported name, see `ExportSpecifier.e` */
+  readonly e: Int32Array;
+  /** Start of local name or -1, see `ExportSpecifier.ls` */
+  readonly ls: Int32Array;
+  /** End of local name or -1, see `ExportSpecifier.le` */
+  readonly le: Int32Array;
+}
+
+/**
+ * Result of `parseRaw`, holding the import and export fields as columns with
+ * one entry per record. Names are only decoded when requested.
+ */
+export class RawParseResult {
+  readonly imports: ImportColumns;
+  readonly exports: ExportColumns;
+  readonly importCount: number;
+  readonly exportCount: number;
+  readonly facade: boolean;
+  readonly hasModuleSyntax: boolean;
+  readonly budgetExceeded: boolean;
+  private readonly source: string;
+  private readonly safe: Int32Array;
+
+  constructor (source: string, columns: Int32Array, facade: boolean, hasModuleSyntax: boolean, budgetExceeded: boolean) {
+    const importCount = this.importCount = columns[0];
+    const exportCount = this.exportCount = columns[1];
+    const column = (offset: number, count: number, i: number) => columns.subarray(offset + count * i, offset + count * (i + 1));
+    this.imports = {
+      s: column(2, importCount, 0),
+      e: column(2, importCount, 1),
+      ss: column(2, importCount, 2),
+      se: column(2, importCount, 3),
+      d: column(2, importCount, 4),
+      a: column(2, importCount, 5),
+      t: column(2, importCount, 6)
+    };
+    this.safe = column(2, importCount, 7);
+    const exportOffset = 2 + importCount * 8;
+    this.exports = {
+      s: column(exportOffset, exportCount, 0),
+      e: column(exportOffset, exportCount, 1),
+      ls: column(exportOffset, exportCount, 2),
+      le: column(exportOffset, exportCount, 3)
+    };
+    this.source = source;
+    this.facade = facade;
+    this.hasModuleSyntax = hasModuleSyntax;
+    this.budgetExceeded = budgetExceeded;
+  }
+
+  /**
+   * Module name of the import at `index`, see `ImportSpecifier.n`
+   */
+  importName (index: number): string | undefined {
+    if (!this.safe[index])
+      return undefined;
+    const { s, e, d } = this.imports;
+    return decode(this.source.slice(d[index] === -1 ? s[index] - 1 : s[index], d[index] === -1 ? e[index] + 1 : e[index]));
+  }
+
+  /**
+   * Exported name of the export at `index`, see `ExportSpecifier.n`
+   */
+  exportName (index: number): string {
+    const n = this.source.slice(this.exports.s[index], this.exports.e[index]), ch = n[0];
+    return (ch === '"' || ch === "'") ? decode(n) : n;
+  }
+
+  /**
+   * Local name of the export at `index`, see `ExportSpecifier.ln`
+   */
+  exportLocalName (index: number): string | undefined {
+    const ls = this.exports.ls[index];
+    if (ls < 0)
+      return undefined;
+    const ln = this.source.slice(ls, this.exports.le[index]), lch = ln[0];
+    return (lch === '"' || lch === "'") ? decode(ln) : ln;
+  }
+}
 
-  const len = source.length + 1;
+/**
+ * Variant of `parse` for hot paths that avoids creating an object per import
+ * and export, returning the same fields as typed array columns instead.
+ *
+ * @param source Source code to parser
+ * @param name Optional sourcename
+ * @param budget Optional maximum number of source code units to lex
+ * @returns Columnar parse result.
+ */
+export function parseRaw (source: string, name = '@', budget = 0): RawParseResult {
+  if (!lexer && !initLazy())
+    // actually returns a promise if init hasn't resolved (not type safe).
+    return init.then(() => parseRaw(source, name, budget)) as unknown as RawParseResult;
+  return lexer.parseRaw(source, name, budget);
+}
 
-  // need 2 bytes per code point plus analysis space so we double again
-  const extraMem = (wasm.__heap_base.value || wasm.__heap_base) as number + len * 4 - wasm.memory.buffer.byteLength;
-  if (extraMem > 0)
-    wasm.memory.grow(Math.ceil(extraMem / 65536));
+/**
+ * Detects whether the source uses ESM syntax, as given by the fourth return
+ * value of `parse`, stopping at the first static import, import.meta or
+ * export statement instead of lexing the full source.
+ *
+ * @param source Source code to parser
+ * @param name Optional sourcename
+ * @returns Whether the source contains module syntax.
+ */
+export function detectModuleSyntax (source: string, name = '@'): boolean {
+  if (!lexer && !initLazy())
+    // actually returns a promise if init hasn't resolved (not type safe).
+    return init.then(() => detectModuleSyntax(source, name)) as unknown as boolean;
+  return lexer.detectModuleSyntax(source, name);
+}
 
-  const addr = wasm.sa(len - 1);
-  (isLE ? copyLE : copyBE)(source, new Uint16Array(wasm.memory.buffer, addr, len));
+/**
+ * A `<script type="module">` or `<script type="importmap">` of an HTML
+ * document, as found by `parseHtml`. All offsets are into the HTML.
+ */
+export interface HtmlScript {
+  /** Type of the script */
+  readonly t: 'module' | 'importmap';
+  /** Start of the `<script>` tag */
+  readonly ss: number;
+  /** End of the `</script>` tag, or of the document when it is missing */
+  readonly se: number;
+  /** Start of the script content */
+  readonly s: number;
+  /** End of the script content */
+  readonly e: number;
+  /**
+   * Value of the `src` attribute as written, without decoding character
+   * references. The content of a script with a `src` is not lexed.
+   */
+  readonly src: string | undefined;
+  /** Imports of a module script, see `parse` */
+  readonly imports: ReadonlyArray<ImportSpecifier>;
+  /** Exports of a module script, see `parse` */
+  readonly exports: ReadonlyArray<ExportSpecifier>;
+  /** Whether a module script is a facade, see `parse` */
+  readonly facade: boolean;
+  /** Whether a module script has module syntax, see `parse` */
+  readonly hasModuleSyntax: boolean;
+  /**
+   * Set when a module script fails to lex, which then has no imports or
+   * exports, instead of throwing
+   */
+  readonly error: ParseError | undefined;
+}
+
+/**
+ * Finds the module scripts and import maps of an HTML document, and lexes
+ * the inline module scripts where they are, without extracting them first.
+ * Scripts are found as the HTML tokenizer does, skipping comments and the
+ * content of other raw text elements such as `<style>` and `<textarea>`.
+ *
+ * @param html HTML source
+ * @param name Optional sourcename
+ * @returns The module scripts and import maps, in document order.
+ */
+export function parseHtml (html: string, name = '@'): ReadonlyArray<HtmlScript> {
+  if (!lexer && !initLazy())
+    // actually returns a promise if init hasn't resolved (not type safe).
+    return init.then(() => parseHtml(html, name)) as unknown as ReadonlyArray<HtmlScript>;
+  return lexer.parseHtml(html, name);
+}
+
+/**
+ * Counters of the last parse, only available in the instrumented build
+ * (`es-module-lexer/stats`). Code unit counts are the distances scanned from
+ * the start of each string, comment, template part or regular expression.
+ */
+export interface LexerStats {
+  /** Code units scanned inside string literals */
+  readonly stringUnits: number;
+  /** Code units scanned inside line and block comments */
+  readonly commentUnits: number;
+  /** Code units scanned inside template literals, outside of substitutions */
+  readonly templateUnits: number;
+  /** Code units scanned inside regular expressions */
+  readonly regexUnits: number;
+  /** How often each rule decided whether a `/` is a division or starts a regular expression */
+  readonly slashRules: {
+    readonly division: number;
+    readonly afterPunctuator: number;
+    readonly afterParenKeyword: number;
+    readonly afterForOf: number;
+    readonly afterStatementBrace: number;
+    readonly afterKeyword: number;
+    readonly afterDivision: number;
+    readonly atStart: number;
+    readonly inExportDefault: number;
+    readonly afterBreakLabel: number;
+  };
+  /** Keyword lookups reading backwards from the last token */
+  readonly keywordLookbacks: number;
+  /** Whitespace code units scanned between `break` / `continue` and a possible label */
+  readonly labelGapUnits: number;
+  /** Longest such gap */
+  readonly maxLabelGap: number;
+  /** Deepest nesting of parens, braces and template substitutions */
+  readonly maxOpenTokenDepth: number;
+  /** Dynamic imports dropped again as method definitions named import */
+  readonly retractedDynamicImports: number;
+}
 
-  if (!wasm.parse())
-    throw Object.assign(new Error(`Parse error ${name}:${source.slice(0, wasm.e()).split('\n').length}:${wasm.e() - source.lastIndexOf('\n', wasm.e() - 1)}`), { idx: wasm.e() });
+const slashRules = ['division', 'afterPunctuator', 'afterParenKeyword', 'afterForOf', 'afterStatementBrace', 'afterKeyword', 'afterDivision', 'atStart', 'inExportDefault', 'afterBreakLabel'] as const;
 
-  const imports: ImportSpecifier[] = [], exports: ExportSpecifier[] = [];
-  while (wasm.ri()) {
+/**
+ * Counters of the last parse of the default lexer, see `Lexer#stats`.
+ *
+ * @returns The counters, or undefined when not using the instrumented build.
+ */
+export function stats (): LexerStats | undefined {
+  return lexer?.stats();
+}
+
+/**
+ * A lexer owning its own wasm instance and memory views, which are reused
+ * across parses. The module-level functions share a default instance, while
+ * separate `Lexer` instances can be pooled by callers, for example dropping
+ * those whose `highWaterMark` has grown too large.
+ *
+ * Can only be constructed once `init` has resolved.
+ */
+export class Lexer {
+  private readonly wasm: WasmExports;
+  private readonly heapBase: number;
+  private memory16: Uint16Array;
+
+  constructor (instance?: WebAssembly.Instance) {
+    if (!wasmModule)
+      throw new Error('es-module-lexer: init must resolve before creating a Lexer.');
+    this.wasm = (instance || new WebAssembly.Instance(wasmModule)).exports as WasmExports;
+    this.heapBase = (this.wasm.__heap_base.value || this.wasm.__heap_base) as number;
+    this.memory16 = new Uint16Array(this.wasm.memory.buffer);
+  }
+
+  /**
+   * Size in bytes that the instance memory has grown to. Wasm memory is never
+   * released, so this is the most memory used by any parse so far.
+   */
+  get highWaterMark (): number {
+    return this.wasm.memory.buffer.byteLength;
+  }
+
+  /**
+   * Bytes of the import and export records written to instance memory by the
+   * last parse.
+   */
+  get analysisBytes (): number {
+    return this.wasm.au();
+  }
+
+  /**
+   * Counters of the last parse, when this is the instrumented build
+   * (`es-module-lexer/stats`), otherwise undefined.
+   */
+  stats (): LexerStats | undefined {
+    if (!this.wasm.st)
+      return undefined;
+    // struct Stats in src/lexer.h
+    const [stringUnits, commentUnits, templateUnits, regexUnits, ...counts] = new Uint32Array(this.wasm.memory.buffer, this.wasm.st(), 19);
+    const [keywordLookbacks, labelGapUnits, maxLabelGap, maxOpenTokenDepth, retractedDynamicImports] = counts.slice(slashRules.length);
+    const rules = {} as { -readonly [rule in keyof LexerStats['slashRules']]: number };
+    slashRules.forEach((rule, i) => rules[rule] = counts[i]);
+    return {
+      stringUnits, commentUnits, templateUnits, regexUnits,
+      slashRules: rules,
+      keywordLookbacks, labelGapUnits, maxLabelGap, maxOpenTokenDepth, retractedDynamicImports
+    };
+  }
+
+  /**
+   * See the module-level `parse`.
+   */
+  parse (source: string, name = '@', budget = 0): ReturnType<typeof parse> {
+    return this.lex(source, name, budget, false);
+  }
+
+  /**
+   * See the module-level `parseTypeScript`.
+   */
+  parseTypeScript (source: string, name = '@', budget = 0): ReturnType<typeof parse> {
+    return this.lex(source, name, budget, true);
+  }
+
+  /**
+   * See the module-level `parseRaw`.
+   */
+  parseRaw (source: string, name = '@', budget = 0): RawParseResult {
+    const wasm = this.wasm;
+    let t = LEXER_TRACE ? performance.now() : 0;
+    this.copySource(source);
+    if (budget > 0)
+      wasm.sb(budget);
+    if (LEXER_TRACE) t = tracePhase('copy', t, name, source);
+
+    const success = wasm.parse();
+    if (LEXER_TRACE) t = tracePhase('parse', t, name, source);
+    if (!success && !wasm.bx())
+      throw this.parseError(source, name);
+
+    const addr = wasm.wc();
+    const counts = new Int32Array(wasm.memory.buffer, addr, 2);
+    // copied out of wasm memory, which is reused by the next parse
+    const columns = new Int32Array(wasm.memory.buffer, addr, 2 + counts[0] * 8 + counts[1] * 4).slice();
+    if (LEXER_TRACE) tracePhase('extract', t, name, source);
+    return new RawParseResult(source, columns, !!wasm.f(), !!wasm.ms(), !!wasm.bx());
+  }
+
+  /**
+   * See the module-level `detectModuleSyntax`.
+   */
+  detectModuleSyntax (source: string, name = '@'): boolean {
+    let t = LEXER_TRACE ? performance.now() : 0;
+    this.copySource(source);
+    if (LEXER_TRACE) t = tracePhase('copy', t, name, source);
+
+    const success = this.wasm.md();
+    if (LEXER_TRACE) tracePhase('detect', t, name, source);
+    if (!success)
+      throw this.parseError(source, name);
+
+    return !!this.wasm.ms();
+  }
+
+  /**
+   * See the module-level `parseHtml`.
+   */
+  parseHtml (html: string, name = '@'): ReadonlyArray<HtmlScript> {
+    const wasm = this.wasm;
+    let t = LEXER_TRACE ? performance.now() : 0;
+    this.copySource(html);
+    if (LEXER_TRACE) t = tracePhase('copy', t, name, html);
+
+    wasm.ph();
+    if (LEXER_TRACE) t = tracePhase('parse', t, name, html);
+
+    // a row per script, see hw in src/lexer.h
+    const addr = wasm.hw();
+    const count = new Int32Array(wasm.memory.buffer, addr, 1)[0];
+    const rows = new Int32Array(wasm.memory.buffer, addr + 4, count * 12);
+    const scripts: HtmlScript[] = [];
+    for (let i = 0; i < count; i++) {
+      const [type, ss, se, s, e, us, ue, importCount, exportCount, facade, hasModuleSyntax, err] = rows.subarray(i * 12, i * 12 + 12);
+      // the records of every script follow those of the scripts before it
+      const imports: ImportSpecifier[] = [], exports: ExportSpecifier[] = [];
+      for (let j = 0; j < importCount && wasm.ri(); j++)
+        imports.push(this.readImport(html));
+      for (let j = 0; j < exportCount && wasm.re(); j++)
+        exports.push(this.readExport(html));
+      scripts.push({
+        t: type === 1 ? 'module' : 'importmap',
+        ss, se, s, e,
+        src: us < 0 ? undefined : html.slice(us, ue),
+        imports, exports,
+        facade: !!facade,
+        hasModuleSyntax: !!hasModuleSyntax,
+        error: err < 0 ? undefined : this.parseError(html, name, err)
+      });
+    }
+    if (LEXER_TRACE) tracePhase('extract', t, name, html);
+    return scripts;
+  }
+
+  private lex (source: string, name: string, budget: number, typescript: boolean): ReturnType<typeof parse> {
+    const wasm = this.wasm;
+    let t = LEXER_TRACE ? performance.now() : 0;
+    this.copySource(source);
+    if (budget > 0)
+      wasm.sb(budget);
+    if (LEXER_TRACE) t = tracePhase('copy', t, name, source);
+
+    const success = typescript ? wasm.pt() : wasm.parse();
+    if (LEXER_TRACE) t = tracePhase('parse', t, name, source);
+    if (!success && !wasm.bx())
+      throw this.parseError(source, name);
+
+    const imports: ImportSpecifier[] = [], exports: ExportSpecifier[] = [];
+    while (wasm.ri())
+      imports.push(this.readImport(source, typescript));
+    while (wasm.re())
+      exports.push(this.readExport(source, typescript));
+    if (LEXER_TRACE) tracePhase('extract', t, name, source);
+
+    return [imports, exports, !!wasm.f(), !!wasm.ms(), !!wasm.bx()];
+  }
+
+  private readImport (source: string, typescript = false): ImportSpecifier {
+    const wasm = this.wasm;
     const s = wasm.is(), e = wasm.ie(), t = wasm.it(), a = wasm.ai(), d = wasm.id(), ss = wasm.ss(), se = wasm.se();
     let n;
     if (wasm.ip())
       n = decode(source.slice(d === -1 ? s - 1 : s, d === -1 ? e + 1 : e));
-    imports.push({ n, t, s, e, ss, se, d, a });
+    if (typescript)
+      return { n, t, s, e, ss, se, d, a, typeOnly: !!wasm.iy() };
+    return { n, t, s, e, ss, se, d, a };
   }
-  while (wasm.re()) {
+
+  private readExport (source: string, typescript = false): ExportSpecifier {
+    const wasm = this.wasm;
     const s = wasm.es(), e = wasm.ee(), ls = wasm.els(), le = wasm.ele();
     const n = source.slice(s, e), ch = n[0];
     const ln = ls < 0 ? undefined : source.slice(ls, le), lch = ln ? ln[0] : '';
-    exports.push({
+    const exp: { -readonly [field in keyof ExportSpecifier]: ExportSpecifier[field] } = {
       s, e, ls, le,
       n: (ch === '"' || ch === "'") ? decode(n) : n,
       ln: (lch === '"' || lch === "'") ? decode(ln) : ln,
-    });
+    };
+    if (typescript)
+      exp.typeOnly = !!wasm.ey();
+    return exp;
   }
 
-  function decode (str: string | undefined) {
-    try {
-      return (0, eval)(str as string) // eval(undefined) -> undefined
+  private copySource (source: string) {
+    const len = source.length + 1;
+    let memory16 = this.memory16;
+
+    // views are detached whenever the memory grows, which the lexer itself
+    // also does for the analysis space
+    if (memory16.length === 0)
+      memory16 = this.memory16 = new Uint16Array(this.wasm.memory.buffer);
+
+    // need 2 bytes per code point
+    const extraMem = this.heapBase + len * 2 - memory16.byteLength;
+    if (extraMem > 0) {
+      this.wasm.memory.grow(Math.ceil(extraMem / 65536));
+      memory16 = this.memory16 = new Uint16Array(this.wasm.memory.buffer);
+    }
+
+    const addr = this.wasm.sa(source.length);
+
+    // ASCII is written as UTF-8 into the upper half of the source space and
+    // widened by the lexer. Encoding stops at the first chunk that is not
+    // ASCII, with the rest of the source then copied a code unit at a time.
+    let oneByteLen = 0;
+    if (encoder && source.length > 64) {
+      const bytes = new Uint8Array(memory16.buffer, addr + source.length, source.length);
+      while (oneByteLen < source.length) {
+        const chunk = source.length <= ONE_BYTE_CHUNK ? source : source.slice(oneByteLen, oneByteLen + ONE_BYTE_CHUNK);
+        if (encoder.encodeInto(chunk, bytes.subarray(oneByteLen, oneByteLen + chunk.length)).read !== chunk.length)
+          break;
+        oneByteLen += chunk.length;
+      }
+      if (oneByteLen > 0)
+        this.wasm.sw(oneByteLen);
     }
-    catch (e) {}
+    if (oneByteLen < source.length)
+      (isLE ? copyLE : copyBE)(source, memory16, addr >> 1, oneByteLen);
   }
 
-  return [imports, exports, !!wasm.f(), !!wasm.ms()];
+  private parseError (source: string, name: string, idx = this.wasm.e()): ParseError {
+    return Object.assign(new Error(`Parse error ${name}:${source.slice(0, idx).split('\n').length}:${idx - source.lastIndexOf('\n', idx - 1)}`), { idx });
+  }
+}
+
+/**
+ * Records a parse phase from `start` until now as a `performance.measure`
+ * entry named `es-module-lexer:<phase>`, with the source name and length as
+ * its detail.
+ */
+function tracePhase (phase: string, start: number, name: string, source: string): number {
+  const end = performance.now();
+  performance.measure(`es-module-lexer:${phase}`, { start, end, detail: { name, size: source.length } });
+  return end;
 }
 
-function copyBE (src: string, outBuf16: Uint16Array) {
+function copyBE (src: string, outBuf16: Uint16Array, offset: number, i: number) {
   const len = src.length;
-  let i = 0;
   while (i < len) {
     const ch = src.charCodeAt(i);
-    outBuf16[i++] = (ch & 0xff) << 8 | ch >>> 8;
+    outBuf16[offset + i++] = (ch & 0xff) << 8 | ch >>> 8;
   }
 }
 
-function copyLE (src: string, outBuf16: Uint16Array) {
+function copyLE (src: string, outBuf16: Uint16Array, offset: number, i: number) {
   const len = src.length;
-  let i = 0;
   while (i < len)
-    outBuf16[i] = src.charCodeAt(i++);
+    outBuf16[offset + i] = src.charCodeAt(i++);
 }
 
-let wasm: {
+type WasmExports = {
   __heap_base: {value: number} | number & {value: undefined};
   memory: WebAssembly.Memory;
   parse(): boolean;
@@ -273,6 +770,28 @@ let wasm: {
   ai(): number;
   /** getErr */
   e(): number;
+  /** setBudget */
+  sb(budget: number): void;
+  /** getBudgetExceeded */
+  bx(): boolean;
+  /** writeColumns */
+  wc(): number;
+  /** getAnalysisUsed */
+  au(): number;
+  /** widenSource */
+  sw(len: number): void;
+  /** parseHtml */
+  ph(): boolean;
+  /** writeScripts */
+  hw(): number;
+  /** parseTypeScript */
+  pt(): boolean;
+  /** getImportTypeOnly */
+  iy(): boolean;
+  /** getExportTypeOnly */
+  ey(): boolean;
+  /** getStats, only in the instrumented build */
+  st?(): number;
   /** getExportEnd */
   ee(): number;
   /** getExportLocalEnd */
@@ -285,6 +804,8 @@ let wasm: {
   f(): boolean;
   /** hasModuleSyntax */
   ms(): boolean;
+  /** detectModuleSyntax */
+  md(): boolean;
   /** getImportDynamic */
   id(): number;
   /** getImportEnd */
@@ -305,24 +826,88 @@ let wasm: {
   ss(): number;
 };
 
-const getWasmBytes = () => (
-  binary => typeof Buffer !== 'undefined'
-    ? Buffer.from(binary, 'base64')
-    : Uint8Array.from(atob(binary), x => x.charCodeAt(0))
-)('WASM_BINARY');
+/**
+ * Wasm memory can only grow, so after lexing a very large source the memory
+ * stays reserved. This drops the current instance when its memory has grown
+ * beyond `threshold` bytes, replacing it with a fresh instance.
+ *
+ * @param threshold Memory size in bytes above which to reset
+ * @returns Whether the instance was reset.
+ */
+export function resetMemory (threshold = 0): boolean {
+  if (!lexer || lexer.highWaterMark <= threshold)
+    return false;
+  lexer = new Lexer();
+  return true;
+}
+
+// the default lexer used by the module-level functions
+let lexer: Lexer;
+
+let wasmModule: WebAssembly.Module;
+
+// The default build embeds the wasm binary as base64. The asset build
+// (dist/lexer.asset.js) leaves it empty and instead loads the lexer.wasm file
+// next to the module, only compiling it once it is first needed.
+const wasmBinary = 'WASM_BINARY';
+
+const getWasmUrl = () => new URL('./lexer.wasm', 'WASM_URL');
+
+// node:fs when running in Node.js, without importing it for other environments
+const getNodeFs = (): typeof import('fs') | undefined =>
+  typeof process !== 'undefined' && (process as any).getBuiltinModule?.('fs');
+
+const getWasmBytes = (): Uint8Array => {
+  if (wasmBinary)
+    return typeof Buffer !== 'undefined'
+      ? Buffer.from(wasmBinary, 'base64')
+      : Uint8Array.from(atob(wasmBinary), x => x.charCodeAt(0));
+  const fs = getNodeFs();
+  if (!fs)
+    throw new Error('Synchronous initialization of the es-module-lexer asset build is only supported in Node.js.');
+  return fs.readFileSync(getWasmUrl());
+};
+
+const compileWasm = (): Promise<WebAssembly.Module> => {
+  if (wasmBinary)
+    return WebAssembly.compile(getWasmBytes());
+  const fs = getNodeFs();
+  if (fs)
+    return fs.promises.readFile(getWasmUrl()).then(bytes => WebAssembly.compile(bytes));
+  return WebAssembly.compileStreaming(fetch(getWasmUrl()));
+};
+
+let initPromise: Promise<void> | undefined;
+const startInit = () => initPromise || (initPromise = compileWasm()
+.then(compiled => WebAssembly.instantiate(wasmModule = compiled))
+.then(instance => { lexer = new Lexer(instance); }));
+
+// In the asset build, the first parse in Node.js compiles synchronously
+// instead of returning a promise
+const initLazy = () => {
+  if (wasmBinary || !getNodeFs())
+    return false;
+  initSync();
+  return true;
+};
 
 /**
  * Wait for init to resolve before calling `parse`.
+ *
+ * For the asset build, compilation only starts once init is awaited.
  */
-export const init = WebAssembly.compile(getWasmBytes())
-.then(WebAssembly.instantiate)
-.then(({ exports }) => { wasm = exports as typeof wasm; });
+export const init: Promise<void> = wasmBinary ? startInit() : {
+  then: (onfulfilled, onrejected) => startInit().then(onfulfilled, onrejected),
+  catch: onrejected => startInit().catch(onrejected),
+  finally: onfinally => startInit().finally(onfinally),
+  [Symbol.toStringTag]: 'Promise'
+};
 
 export const initSync = () => {
-  if (wasm) {
+  if (lexer) {
     return;
   }
-  const compiled = new WebAssembly.Module(getWasmBytes());
-  wasm = new WebAssembly.Instance(compiled).exports as typeof wasm;
+  wasmModule = new WebAssembly.Module(getWasmBytes());
+  lexer = new Lexer();
   return;
 };
@@ -0,0 +1,457 @@
+/*
+ * Parallel parsing of a single large source, for native builds only
+ *
+ *   cc -DLEXER_THREADS -pthread ...  (including this file in place of lexer.c)
+ *
+ * pp splits the source into chunks that are lexed on a thread each, with the
+ * same results as parse. The chunks start right after a ";", where the lexer
+ * is almost always in the main loop rather than in a string, comment,
+ * template or regular expression, so that each chunk after the first can be
+ * lexed speculatively from there. What a chunk cannot know is the stack of
+ * open tokens before it: it stacks them as Unset entries below CHUNK_BASE, and
+ * records what it decided about them (see lexer.h). Decisions on the depth
+ * only depend on the lowest depth it reaches, at which an import or export
+ * statement is taken to be at the top level.
+ *
+ * The chunks are then stitched in order on the calling thread, which holds
+ * the state the serial parse would have at each chunk start. A chunk is taken
+ * when the previous one ended exactly on its start, without a dynamic import
+ * or class brace pending, and everything it assumed holds for the open tokens
+ * of that state. Otherwise, the calling thread lexes the chunk itself from
+ * that state. Either way the chunk leaves the state at its end for the next.
+ */
+
+#ifndef LEXER_THREADS
+#define LEXER_THREADS
+#endif
+#include <pthread.h>
+#include <stdlib.h>
+#include "lexer.c"
+
+// open tokens a chunk can pop below its start
+#define CHUNK_BASE 1024
+// the serial parse stacks up to 1024 open tokens, each above the base
+#define CHUNK_OPEN_TOKENS (CHUNK_BASE + 1024)
+#define CHUNK_DYNAMIC_IMPORTS 512
+// code units searched for a ";" ending a line before taking any ";"
+#define CHUNK_LINE_SEARCH 65536
+
+// the lexer state carried from one chunk to the next
+typedef struct {
+  char16_t* pos;
+  char16_t* last_token_pos;
+  char16_t* break_label_end;
+  bool last_slash_was_division;
+  bool next_brace_is_class;
+  bool facade;
+  bool has_module_syntax;
+  bool has_error;
+  uint32_t parse_error;
+  OpenToken* open_tokens;
+  uint16_t open_token_depth;
+  Import** dynamic_imports;
+  uint16_t dynamic_import_depth;
+  Import* first_import;
+  Import* import_write_head;
+  Import* import_write_head_last;
+  Export* first_export;
+  Export* export_write_head;
+} LexState;
+
+struct Chunk {
+  char16_t* start;
+  char16_t* stop;
+  // continues in the main loop from state, rather than lexing from the start
+  bool resume;
+  bool speculative;
+  // ran out of open tokens below its start, of analysis space or of memory
+  bool failed;
+  // lexed on a thread of its own, which is joined
+  bool threaded;
+  LexState state;
+  // the arena of a speculative chunk, with room for one more record at its end
+  void* analysis;
+  void* analysis_end;
+  // lowest open token depth reached, and the depth taken as the top level
+  uint16_t min_depth;
+  int32_t top_level_depth;
+  struct { uint16_t index; enum OpenTokenRule rule; }* assumptions;
+  uint32_t assumption_count;
+  uint32_t assumption_capacity;
+  pthread_t thread;
+};
+
+static const char16_t* parallelSource;
+static uint32_t parallelSourceLen;
+
+// the memory of the previous pp, whose records are read until the next one
+static struct Chunk* parallelChunks = NULL;
+static uint32_t parallelChunkCount = 0;
+static void* parallelMemory = NULL;
+
+static void saveState (LexState* state) {
+  state->pos = pos;
+  state->last_token_pos = lastTokenPos;
+  state->break_label_end = breakLabelEnd;
+  state->last_slash_was_division = lastSlashWasDivision;
+  state->next_brace_is_class = nextBraceIsClass;
+  state->facade = facade;
+  state->has_module_syntax = hasModuleSyntax;
+  state->has_error = has_error;
+  state->parse_error = parse_error;
+  state->open_tokens = openTokenStack;
+  state->open_token_depth = openTokenDepth;
+  state->dynamic_imports = dynamicImportStack;
+  state->dynamic_import_depth = dynamicImportStackDepth;
+  state->first_import = first_import;
+  state->import_write_head = import_write_head;
+  state->import_write_head_last = import_write_head_last;
+  state->first_export = first_export;
+  state->export_write_head = export_write_head;
+}
+
+static void loadState (const LexState* state) {
+  pos = state->pos;
+  lastTokenPos = state->last_token_pos;
+  breakLabelEnd = state->break_label_end;
+  lastSlashWasDivision = state->last_slash_was_division;
+  nextBraceIsClass = state->next_brace_is_class;
+  facade = state->facade;
+  hasModuleSyntax = state->has_module_syntax;
+  has_error = state->has_error;
+  parse_error = state->parse_error;
+  openTokenStack = state->open_tokens;
+  openTokenDepth = state->open_token_depth;
+  dynamicImportStack = state->dynamic_imports;
+  dynamicImportStackDepth = state->dynamic_import_depth;
+  first_import = state->first_import;
+  import_write_head = state->import_write_head;
+  import_write_head_last = state->import_write_head_last;
+  first_export = state->first_export;
+  export_write_head = state->export_write_head;
+}
+
+static void failChunk () {
+  chunk->failed = true;
+  pos = end + 1;
+}
+
+// called by parse once it has set up a chunk, returning whether to continue
+// in the main loop
+bool beginChunk () {
+  end = (char16_t*)source + sourceLen - 1;
+  stopPos = chunk->stop;
+  if (!chunk->resume) {
+    chunk->state.open_tokens[0] = openTokenStack[0];
+    openTokenStack = chunk->state.open_tokens;
+    dynamicImportStack = chunk->state.dynamic_imports;
+    return false;
+  }
+  loadState(&chunk->state);
+  pos--;
+  return true;
+}
+
+void reserveChunkAnalysis (size_t size) {
+  if (!chunk->speculative || (char*)analysis_head + size <= (char*)chunk->analysis_end)
+    return;
+  failChunk();
+  analysis_head = analysis_base;
+}
+
+bool openTokensEmpty () {
+  if (chunk == NULL || !chunk->speculative || openTokenDepth > chunk->min_depth)
+    return openTokenDepth == 0;
+  if (openTokenDepth == 1 || chunk->top_level_depth == openTokenDepth) {
+    failChunk();
+    return true;
+  }
+  chunk->min_depth = openTokenDepth - 1;
+  return false;
+}
+
+bool atTopLevel () {
+  if (chunk == NULL || !chunk->speculative || openTokenDepth > chunk->min_depth)
+    return openTokenDepth == 0;
+  if (chunk->top_level_depth != -1 && chunk->top_level_depth != openTokenDepth)
+    failChunk();
+  chunk->top_level_depth = openTokenDepth;
+  return true;
+}
+
+OpenToken* assumeOpenToken (uint16_t index, enum OpenTokenRule rule) {
+  if (chunk == NULL || !chunk->speculative)
+    return &openTokenStack[index];
+  if (chunk->assumption_count == chunk->assumption_capacity) {
+    uint32_t capacity = chunk->assumption_capacity ? chunk->assumption_capacity * 2 : 64;
+    void* assumptions = realloc(chunk->assumptions, capacity * sizeof(*chunk->assumptions));
+    // without a record of what it assumed, the chunk is lexed again when stitching
+    if (assumptions == NULL) {
+      failChunk();
+      return &openTokenStack[index];
+    }
+    chunk->assumptions = assumptions;
+    chunk->assumption_capacity = capacity;
+  }
+  chunk->assumptions[chunk->assumption_count].index = index;
+  chunk->assumptions[chunk->assumption_count++].rule = rule;
+  return &openTokenStack[index];
+}
+
+static bool openTokenRule (OpenToken* token, enum OpenTokenRule rule) {
+  switch (rule) {
+    case IsImportParen:
+      return token->token == ImportParen;
+    case IsTemplateBrace:
+      return token->token == TemplateBrace;
+    case IsTemplate:
+      return token->token == Template;
+    case IsParenKeyword:
+      return isParenKeyword(token);
+    case IsForParen:
+      return token->token == AnyParen && token->keyword == For;
+    case IsStatementBrace:
+      return isExpressionTerminator(token) || token->token == ClassBrace;
+  }
+  return false;
+}
+
+static void* lexChunk (void* arg) {
+  setSource((void*)parallelSource);
+  sourceLen = parallelSourceLen;
+  chunk = arg;
+  analysis_base = analysis_head = chunk->analysis;
+  parse();
+  saveState(&chunk->state);
+  chunk = NULL;
+  return NULL;
+}
+
+// whether a chunk lexed speculatively from its start matches state, where
+// the previous chunk ended
+static bool canStitch (struct Chunk* next, LexState* state) {
+  if (next->failed || state->pos != next->start || state->last_token_pos != next->start - 1 ||
+      state->dynamic_import_depth != 0 || state->next_brace_is_class)
+    return false;
+  // the chunk's depth d is state depth + d - CHUNK_BASE, where the top level is
+  int32_t top_level = CHUNK_BASE - state->open_token_depth;
+  if (top_level > next->min_depth || next->top_level_depth != -1 && next->top_level_depth != top_level)
+    return false;
+  for (uint32_t i = 0; i < next->assumption_count; i++) {
+    int32_t index = next->assumptions[i].index - top_level;
+    // below the top level, only read as guarded by the depth
+    if (index < 0 || index >= CHUNK_OPEN_TOKENS)
+      continue;
+    if (openTokenRule(&state->open_tokens[index], next->assumptions[i].rule))
+      return false;
+  }
+  for (int32_t i = CHUNK_OPEN_TOKENS - 1; i >= next->min_depth; i--) {
+    if (next->state.open_tokens[i].token != Unset) {
+      if (i - top_level >= CHUNK_OPEN_TOKENS)
+        return false;
+      break;
+    }
+  }
+  return true;
+}
+
+static void stitch (struct Chunk* next, LexState* state) {
+  int32_t top_level = CHUNK_BASE - state->open_token_depth;
+  for (int32_t i = next->min_depth; i < CHUNK_OPEN_TOKENS; i++) {
+    if (next->state.open_tokens[i].token != Unset)
+      state->open_tokens[i - top_level] = next->state.open_tokens[i];
+  }
+  state->open_token_depth = next->state.open_token_depth - top_level;
+  memcpy(state->dynamic_imports, next->state.dynamic_imports, next->state.dynamic_import_depth * sizeof(Import*));
+  state->dynamic_import_depth = next->state.dynamic_import_depth;
+
+  if (next->state.first_import != NULL) {
+    if (state->import_write_head == NULL)
+      state->first_import = next->state.first_import;
+    else
+      state->import_write_head->next = next->state.first_import;
+    // the first import of the chunk follows the last one before it
+    state->import_write_head_last = next->state.import_write_head_last != NULL ? next->state.import_write_head_last : state->import_write_head;
+    state->import_write_head = next->state.import_write_head;
+  }
+  if (next->state.first_export != NULL) {
+    if (state->export_write_head == NULL)
+      state->first_export = next->state.first_export;
+    else
+      state->export_write_head->next = next->state.first_export;
+    state->export_write_head = next->state.export_write_head;
+  }
+
+  state->pos = next->state.pos;
+  state->last_token_pos = next->state.last_token_pos;
+  state->break_label_end = next->state.break_label_end;
+  state->last_slash_was_division = next->state.last_slash_was_division;
+  state->next_brace_is_class = next->state.next_brace_is_class;
+  state->has_module_syntax = state->has_module_syntax || next->state.has_module_syntax;
+  state->has_error = next->state.has_error;
+  state->parse_error = next->state.parse_error;
+}
+
+// whether a line ending in ";" looks like code, rather than a comment
+static bool isCodeLine (const char16_t* lineEnd) {
+  const char16_t* lineStart = lineEnd;
+  while (lineStart > source && !isBr(*(lineStart - 1)))
+    lineStart--;
+  while (lineStart < lineEnd && isWsNotBr(*lineStart))
+    lineStart++;
+  return *lineStart != '*' && *lineStart != '/';
+}
+
+// the start of the chunk at or after from, just after a ";" that preferably
+// ends a line of code, which is less likely to be in a comment or string
+static char16_t* chunkStart (const char16_t* from) {
+  const char16_t* sourceEnd = source + sourceLen;
+  const char16_t* first = NULL;
+  for (const char16_t* p = from; p + 1 < sourceEnd && p < from + CHUNK_LINE_SEARCH; p++) {
+    if (*p != ';')
+      continue;
+    if (isBr(*(p + 1)) && isCodeLine(p))
+      return (char16_t*)p + 1;
+    if (first == NULL)
+      first = p;
+  }
+  if (first == NULL) {
+    first = from + CHUNK_LINE_SEARCH < sourceEnd ? from + CHUNK_LINE_SEARCH : sourceEnd;
+    while (first < sourceEnd && *first != ';')
+      first++;
+  }
+  return first + 1 < sourceEnd ? (char16_t*)first + 1 : NULL;
+}
+
+// frees the chunks and records of the previous pp
+static void releaseChunks () {
+  for (uint32_t i = 0; i < parallelChunkCount; i++) {
+    free(parallelChunks[i].assumptions);
+    free(parallelChunks[i].state.open_tokens);
+  }
+  free(parallelChunks);
+  free(parallelMemory);
+  parallelChunks = NULL;
+  parallelChunkCount = 0;
+  parallelMemory = NULL;
+}
+
+// parseParallel
+// parses the source in up to the given number of chunks, each on a thread of
+// its own, with the same results as parse (without its work budget)
+// when memory for the chunks cannot be allocated, it parses serially, and a
+// chunk whose thread cannot be created is lexed on the calling thread instead
+bool pp (uint32_t chunks) {
+  releaseChunks();
+
+  if (chunks < 1)
+    chunks = 1;
+  char16_t** starts = malloc((chunks + 1) * sizeof(char16_t*));
+  if (starts == NULL)
+    return parse();
+  uint32_t count = 1;
+  starts[0] = (char16_t*)source;
+  for (uint32_t i = 1; i < chunks; i++) {
+    const char16_t* from = source + (uint64_t)sourceLen * i / chunks;
+    if (from < starts[count - 1])
+      from = starts[count - 1];
+    char16_t* start = chunkStart(from);
+    if (start == NULL)
+      break;
+    starts[count++] = start;
+  }
+  starts[count] = (char16_t*)source + sourceLen + 1;
+
+  if (count == 1) {
+    free(starts);
+    return parse();
+  }
+
+  parallelSource = source;
+  parallelSourceLen = sourceLen;
+  parallelChunks = calloc(count, sizeof(struct Chunk));
+  if (parallelChunks == NULL) {
+    free(starts);
+    return parse();
+  }
+  parallelChunkCount = count;
+
+  // records of the speculative chunks, in arenas sized as the one of the source
+  size_t arenaSize = 0;
+  for (uint32_t i = 1; i < count; i++)
+    arenaSize += (starts[i + 1] - starts[i] + 1) * 64 + 64;
+  char* arena = parallelMemory = malloc(arenaSize);
+  // the first chunk is lexed on this thread, so it needs its open tokens too
+  parallelChunks[0].state.open_tokens = malloc(CHUNK_OPEN_TOKENS * sizeof(OpenToken) + CHUNK_DYNAMIC_IMPORTS * sizeof(Import*));
+  if (arena == NULL || parallelChunks[0].state.open_tokens == NULL) {
+    free(starts);
+    releaseChunks();
+    return parse();
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    struct Chunk* c = &parallelChunks[i];
+    c->start = starts[i];
+    c->stop = starts[i + 1];
+    c->min_depth = CHUNK_BASE;
+    c->top_level_depth = -1;
+    if (i > 0) {
+      c->analysis = arena;
+      arena += (c->stop - c->start + 1) * 64;
+      c->analysis_end = arena;
+      arena += 64;
+      c->state.open_tokens = malloc(CHUNK_OPEN_TOKENS * sizeof(OpenToken) + CHUNK_DYNAMIC_IMPORTS * sizeof(Import*));
+    }
+    // a chunk that cannot be lexed speculatively is lexed when stitching
+    if (c->state.open_tokens == NULL) {
+      c->failed = true;
+      continue;
+    }
+    c->state.dynamic_imports = (Import**)(c->state.open_tokens + CHUNK_OPEN_TOKENS);
+    for (uint32_t j = 0; j < CHUNK_OPEN_TOKENS; j++)
+      c->state.open_tokens[j] = (OpenToken){ Unset, NoKeyword, (char16_t*)EMPTY_CHAR };
+    if (i == 0)
+      continue;
+    c->resume = true;
+    c->speculative = true;
+    c->state.pos = c->start;
+    c->state.last_token_pos = c->start - 1;
+    c->state.open_token_depth = CHUNK_BASE;
+    c->threaded = pthread_create(&c->thread, NULL, lexChunk, c) == 0;
+    if (!c->threaded)
+      c->failed = true;
+  }
+  free(starts);
+
+  // the first chunk from the start on this thread, then stitching the others
+  struct Chunk* first = &parallelChunks[0];
+  chunk = first;
+  parse();
+  LexState state;
+  saveState(&state);
+  chunk = NULL;
+
+  for (uint32_t i = 1; i < count; i++) {
+    struct Chunk* next = &parallelChunks[i];
+    if (next->threaded)
+      pthread_join(next->thread, NULL);
+    // lexed up to the end in the facade, or stopped at an error
+    if (state.facade || state.has_error)
+      continue;
+    if (canStitch(next, &state)) {
+      stitch(next, &state);
+      continue;
+    }
+    struct Chunk resumed = { .start = state.pos, .stop = next->stop, .resume = true, .state = state };
+    chunk = &resumed;
+    parse();
+    saveState(&state);
+    chunk = NULL;
+  }
+
+  loadState(&state);
+  import_read_head = NULL;
+  export_read_head = NULL;
+  budgetExceeded = false;
+  return !(openTokenDepth || has_error || dynamicImportStackDepth);
+}
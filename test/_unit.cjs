@@ -1,16 +1,16 @@
 const assert = require('assert');
 
 let js = false;
-let parse;
+let parse, parseRaw, parseHtml, parseTypeScript, detectModuleSyntax, resetMemory, Lexer, stats;
 const init = (async () => {
   if (parse) return;
   if (process.env.WASM) {
-    const m = await import('../dist/lexer.js');
+    const m = await import(process.env.WASM === 'fast' || process.env.WASM === 'asset' || process.env.WASM === 'stats' ? `../dist/lexer.${process.env.WASM}.js` : '../dist/lexer.js');
     await m.init;
-    parse = m.parse;
+    ({ parse, parseRaw, parseHtml, parseTypeScript, detectModuleSyntax, resetMemory, Lexer, stats } = m);
   }
   else if (process.env.ASM) {
-    ({ parse } = await import('../dist/lexer.asm.js'));
+    ({ parse, detectModuleSyntax, resetMemory } = await import('../dist/lexer.asm.js'));
   }
   else {
     js = true;
@@ -407,6 +407,22 @@ suite('Lexer', () => {
     assert.strictEqual(imports.length, 0);
   });
 
+  if (!js)
+  test('Regexp break and continue labels', () => {
+    const [imports] = parse(`
+      outer: for (;;) {
+        if (foo) break	outer
+        /import("a")/.test(bar) || baz()
+        const breaks = 4, b = breaks / 2 / import("b");
+        if (foo) continue outer;
+        const c = outer / 2 / import("c");
+      }
+    `);
+    assert.strictEqual(imports.length, 2);
+    assert.strictEqual(imports[0].n, 'b');
+    assert.strictEqual(imports[1].n, 'c');
+  });
+
   test('Regexp division', () => {
     parse(`\nconst x = num / /'/.exec(l)[0].slice(1, -1)//'"`);
   });
@@ -1556,6 +1572,302 @@ function x() {
     const [,,, hasModuleSyntax] = parse('export * from "./foo"')
     assert.strictEqual(hasModuleSyntax, true)
   })
+
+  if (!js)
+  test('detectModuleSyntax', () => {
+    assert.strictEqual(detectModuleSyntax('import foo from "./foo"'), true);
+    assert.strictEqual(detectModuleSyntax('import.meta.url'), true);
+    assert.strictEqual(detectModuleSyntax('export {}'), true);
+    assert.strictEqual(detectModuleSyntax('const foo = "foo";\nexport default foo;'), true);
+    assert.strictEqual(detectModuleSyntax('import("./foo")'), false);
+    assert.strictEqual(detectModuleSyntax('const foo = "import"; require("./foo")'), false);
+  })
+
+  if (!js)
+  test('detectModuleSyntax ignores keywords in strings, comments, regexes and templates', () => {
+    const source = `
+      // import foo from 'foo';
+      /* export { x } */
+      const a = 'import a from "a"', b = "export *";
+      const re = /import x from 'x'/g;
+      const t = \`\${\`export default \${'x'}\`} import y from 'y'\`;
+      module.exports = { a, b, re, t };
+    `;
+    assert.strictEqual(detectModuleSyntax(source), false);
+    assert.strictEqual(detectModuleSyntax(source + 'export var p = 5;'), true);
+  })
+
+  if (!js)
+  test('Work budget', () => {
+    const source = `import a from 'a';\nimport b from 'bbbbbb';\nexport { c, "d" } from 'c';\nconst t = \`\${`;
+    // cut off inside the second import specifier
+    let [impts, expts, facade, ms, exceeded] = parse(source, '@', source.indexOf('bbb'));
+    assert.strictEqual(exceeded, true);
+    assert.strictEqual(impts.length, 1);
+    assert.strictEqual(impts[0].n, 'a');
+    assert.strictEqual(expts.length, 0);
+    assert.strictEqual(ms, true);
+
+    // cut off inside the quoted export name, dropping the whole statement
+    [impts, expts, facade, ms, exceeded] = parse(source, '@', source.indexOf('"d"') + 1);
+    assert.strictEqual(exceeded, true);
+    assert.deepStrictEqual(impts.map(({ n }) => n), ['a', 'bbbbbb']);
+    assert.strictEqual(expts.length, 0);
+
+    // the unterminated template is never reached
+    [impts, expts, facade, ms, exceeded] = parse(source, '@', source.indexOf('const'));
+    assert.strictEqual(exceeded, true);
+    assert.strictEqual(impts.length, 3);
+    assert.strictEqual(expts.length, 2);
+    assert.throws(() => parse(source));
+
+    // cut off inside a dynamic import, before its end is known
+    const dynamicSource = `import a from 'a';\nimport(b + c);`;
+    [impts, expts, facade, ms, exceeded] = parse(dynamicSource, '@', dynamicSource.indexOf('c)'));
+    assert.strictEqual(exceeded, true);
+    assert.deepStrictEqual(impts.map(({ n }) => n), ['a']);
+
+    // cut off inside import attributes, after the specifier
+    const attributesSource = `import a from 'a';\nimport b from 'b' with { type: 'json' };\nimport('c', { with: { type: 'json' } });`;
+    [impts, expts, facade, ms, exceeded] = parse(attributesSource, '@', attributesSource.indexOf('json'));
+    assert.strictEqual(exceeded, true);
+    assert.deepStrictEqual(impts.map(({ n }) => n), ['a']);
+    [impts, expts, facade, ms, exceeded] = parse(attributesSource, '@', attributesSource.lastIndexOf('json'));
+    assert.strictEqual(exceeded, true);
+    assert.deepStrictEqual(impts.map(({ n }) => n), ['a', 'b']);
+
+    // cut off after a dynamic import, which a { would make a method
+    const methodSource = `import a from 'a';\nclass A { import() {} }`;
+    [impts, expts, facade, ms, exceeded] = parse(methodSource, '@', methodSource.indexOf(') {') + 1);
+    assert.strictEqual(exceeded, true);
+    assert.deepStrictEqual(impts.map(({ n }) => n), ['a']);
+
+    // a budget covering the full source has no effect
+    [impts, expts, facade, ms, exceeded] = parse(`export var p = 5;`, '@', 1000);
+    assert.strictEqual(exceeded, false);
+    assert.strictEqual(expts.length, 1);
+
+    // syntax errors before the budget limit still throw
+    assert.throws(() => parse(`const a = 'x\n';\nimport 'y';`, '@', 20));
+  })
+
+  if (!js)
+  test('resetMemory', () => {
+    parse(`export var p = 5;\n${'// padding\n'.repeat(1e5)}`);
+    assert.strictEqual(resetMemory(Infinity), false);
+    assert.strictEqual(resetMemory(), true);
+    const [, [expt]] = parse('export var q = 5');
+    assert.strictEqual(expt.n, 'q');
+  })
+
+  if (!js)
+  test('detectModuleSyntax stops at the first module syntax', () => {
+    // the unterminated template after the import is never reached
+    assert.strictEqual(detectModuleSyntax('import "x";\n`'), true);
+    assert.throws(() => parse('import "x";\n`'));
+    assert.throws(() => detectModuleSyntax('const a = `;\nimport "x";'));
+  })
+
+  // parseRaw is only available in the Wasm builds
+  if (process.env.WASM)
+  test('parseRaw', () => {
+    const source = `import a from './a.js';\nimport('./b' + x);\nimport.meta.url;\nexport { c as d, e, "f" as "g" };\nexport default 5;`;
+    const [imports, exports, facade, hasModuleSyntax] = parse(source);
+    const raw = parseRaw(source);
+    assert.strictEqual(raw.importCount, imports.length);
+    assert.strictEqual(raw.exportCount, exports.length);
+    assert.strictEqual(raw.facade, facade);
+    assert.strictEqual(raw.hasModuleSyntax, hasModuleSyntax);
+    imports.forEach((impt, i) => {
+      for (const field of ['s', 'e', 'ss', 'se', 'd', 'a', 't'])
+        assert.strictEqual(raw.imports[field][i], impt[field], `import ${i} ${field}`);
+      assert.strictEqual(raw.importName(i), impt.n);
+    });
+    exports.forEach((expt, i) => {
+      for (const field of ['s', 'e', 'ls', 'le'])
+        assert.strictEqual(raw.exports[field][i], expt[field], `export ${i} ${field}`);
+      assert.strictEqual(raw.exportName(i), expt.n);
+      assert.strictEqual(raw.exportLocalName(i), expt.ln);
+    });
+  })
+
+  // parseHtml is only available in the Wasm builds
+  if (process.env.WASM)
+  test('parseHtml', () => {
+    const html = `<!DOCTYPE html>
+<!-- <script type="module">import 'commented';</script> -->
+<script type="importmap">{ "imports": { "a": "./a.js" } }</script>
+<SCRIPT TYPE=" Module " data-x=">">
+  import a from 'a';
+  export const x = '</scrip' + 't>';
+  import('./dyn.js');
+</SCRIPT >
+<script>import 'classic';</script>
+<script type="module" src="./main.js">import 'ignored';</script>
+<style><script type="module">import 'style';</script></style>
+<textarea><script type=module>import 'textarea'</script></textarea>
+<script type=module>import 'broken</script>
+<script type=module>export { y } from 'y'</script>`;
+    const scripts = parseHtml(html);
+    assert.deepStrictEqual(scripts.map(({ t, src }) => [t, src]), [['importmap', undefined], ['module', undefined], ['module', './main.js'], ['module', undefined], ['module', undefined]]);
+
+    const [importMap, module, external, broken, reexport] = scripts;
+    assert.strictEqual(html.slice(importMap.s, importMap.e), '{ "imports": { "a": "./a.js" } }');
+    assert.strictEqual(html.slice(importMap.ss, importMap.se), `<script type="importmap">{ "imports": { "a": "./a.js" } }</script>`);
+    assert.strictEqual(importMap.imports.length, 0);
+
+    // offsets are into the HTML, as parse gives them for the script content
+    const content = html.slice(module.s, module.e);
+    assert.ok(html.slice(module.e).startsWith('</SCRIPT >'));
+    assert.strictEqual(module.se, module.e + '</SCRIPT >'.length);
+    const [imports, exports, facade, hasModuleSyntax] = parse(content);
+    assert.deepStrictEqual(module.imports, imports.map(impt => ({
+      ...impt,
+      s: impt.s + module.s, e: impt.e + module.s, ss: impt.ss + module.s,
+      se: impt.se < 0 ? impt.se : impt.se + module.s, d: impt.d < 0 ? impt.d : impt.d + module.s
+    })));
+    assert.deepStrictEqual(module.exports.map(({ n, s }) => [n, s]), exports.map(({ n, s }) => [n, s + module.s]));
+    assert.deepStrictEqual(module.imports.map(({ n }) => n), ['a', './dyn.js']);
+    assert.strictEqual(module.facade, facade);
+    assert.strictEqual(module.hasModuleSyntax, hasModuleSyntax);
+    assert.strictEqual(module.error, undefined);
+
+    // the content of a script with a src is never run
+    assert.strictEqual(html.slice(external.s, external.e), `import 'ignored';`);
+    assert.strictEqual(external.imports.length, 0);
+
+    // a script that fails to lex has no records, but later scripts do
+    assert.strictEqual(broken.error.idx, broken.e);
+    assert.strictEqual(broken.imports.length, 0);
+    assert.deepStrictEqual(reexport.imports.map(({ n }) => n), ['y']);
+    assert.deepStrictEqual(reexport.exports.map(({ n }) => n), ['y']);
+  })
+
+  // parseTypeScript is only available in the Wasm builds
+  if (process.env.WASM)
+  test('parseTypeScript', () => {
+    const source = `
+      import type { A } from './a';
+      import type B, * as C from './b';
+      import type from './type';
+      import { type D } from './d';
+      import { type E, F } from './e';
+      import { type as } from './as';
+      import { type as as } from './as-as';
+      import fs = require('fs');
+      import Alias = NS.Inner;
+      export type { G } from './g';
+      export { type H, I } from './h';
+      export type * as J from './j';
+      export type K<T> = T[];
+      export interface L { l: string }
+      export declare const m: number;
+      export enum N { A }
+      export const enum O { A }
+      export abstract class P {}
+      export default interface Q {}
+      const r = s! / 2 / 3, t = f<number> / 2 / 3;
+      import('./u');
+    `;
+    const [imports, exports, facade, hasModuleSyntax] = parseTypeScript(source);
+    assert.deepStrictEqual(imports.map(({ n, typeOnly }) => [n, typeOnly]), [
+      ['./a', true], ['./b', true], ['./type', false], ['./d', true], ['./e', false],
+      ['./as', true], ['./as-as', false], ['fs', false], ['./g', true], ['./h', false],
+      ['./j', true], ['./u', false]
+    ]);
+    assert.deepStrictEqual(exports.map(({ n, ln, typeOnly }) => [n, ln, typeOnly]), [
+      ['G', undefined, true], ['H', undefined, true], ['I', undefined, false], ['J', undefined, true],
+      ['K', 'K', true], ['L', 'L', true], ['m', 'm', true], ['N', 'N', false], ['O', 'O', false],
+      ['P', 'P', false], ['default', 'Q', true]
+    ]);
+    assert.strictEqual(source.slice(imports[7].ss, imports[7].se), `import fs = require('fs')`);
+    assert.strictEqual(facade, false);
+    assert.strictEqual(hasModuleSyntax, true);
+
+    // a comparison is not taken for type arguments
+    const [[dynamic]] = parseTypeScript(`if (a<b && c > /'/.test(s)) {}\nimport('./x');`);
+    assert.strictEqual(dynamic.n, './x');
+    assert.strictEqual(parseTypeScript('const v = m<Map<K, V[]>> / 2 / 3;')[0].length, 0);
+
+    // the records of parse are unchanged
+    const [[impt]] = parse(`import type { A } from './a';`);
+    assert.strictEqual(impt.typeOnly, undefined);
+    assert.throws(() => parse('const r = s! / 2;'));
+  })
+
+  if (process.env.WASM)
+  test('Lexer instances', () => {
+    const lexer1 = new Lexer(), lexer2 = new Lexer();
+    const [[impt]] = lexer1.parse(`import 'a';`);
+    assert.strictEqual(impt.n, 'a');
+    const initialSize = lexer2.highWaterMark;
+    const [, [expt]] = lexer2.parse(`export var p = 5;\n${'// padding\n'.repeat(1e5)}`);
+    assert.strictEqual(expt.n, 'p');
+    assert.ok(lexer2.highWaterMark > initialSize);
+    assert.ok(lexer1.analysisBytes > 0);
+    lexer1.parse(`const x = 1;`);
+    assert.strictEqual(lexer1.analysisBytes, 0);
+    assert.strictEqual(lexer1.parseRaw(`import 'b';`).importName(0), 'b');
+    assert.strictEqual(lexer1.detectModuleSyntax('export {}'), true);
+    assert.throws(() => lexer1.parse('import {'));
+    // reused after an error
+    assert.strictEqual(lexer1.parse(`export var q = 5;`)[1][0].n, 'q');
+  })
+
+  test('Truncated sources do not depend on the previous parse', () => {
+    // each of these used to read past the end of the source, into memory
+    // left behind by the previous parse
+    for (const source of ['export {// a', 'import {co\n  nst x', 'import "x";\nexport { " r\n`', 'export va', 'export { a }/x']) {
+      const results = ['', `import a from 'a';\nexport { b as c };\n`.repeat(50)].map(previous => {
+        parse(previous);
+        try {
+          return JSON.stringify(parse(source));
+        }
+        catch (err) {
+          return err.idx;
+        }
+      });
+      assert.strictEqual(results[0], results[1], source);
+    }
+  });
+
+  // counters are only kept by the instrumented build
+  if (process.env.WASM === 'stats')
+  test('Parse statistics', () => {
+    parse(`const s = 'abc'; /* c */\nconst r = /re/g; x = a / b;\nif (x) /y/.test(z);\nfor (;;) { break  l; }\nexport default \`a\${(b)}\`;`);
+    const { stringUnits, commentUnits, templateUnits, regexUnits, slashRules, keywordLookbacks, labelGapUnits, maxLabelGap, maxOpenTokenDepth } = stats();
+    assert.strictEqual(stringUnits, 4);
+    assert.strictEqual(commentUnits, 6);
+    assert.strictEqual(templateUnits, 4);
+    assert.strictEqual(regexUnits, 5);
+    assert.strictEqual(slashRules.division, 1);
+    assert.strictEqual(slashRules.afterPunctuator, 1);
+    assert.strictEqual(slashRules.afterParenKeyword, 1);
+    assert.ok(keywordLookbacks > 0);
+    assert.strictEqual(labelGapUnits, 2);
+    assert.strictEqual(maxLabelGap, 2);
+    assert.strictEqual(maxOpenTokenDepth, 3);
+    // reset by every parse
+    parse(`import 'a';`);
+    assert.strictEqual(stats().regexUnits, 0);
+    assert.strictEqual(stats().stringUnits, 2);
+  });
+
+  test('Non-ASCII after long ASCII runs', () => {
+    const padding = '// padding\n'.repeat(7e3);
+    for (const source of [
+      `${padding}import 'ä';\nimport 'b';`,
+      `${padding}${padding}import 'ä';\nimport 'b';`,
+      `import 'a';\n${padding}const s = '€';\nexport var p = 5;`,
+    ]) {
+      const [imports, exports] = parse(source);
+      for (const impt of imports)
+        assert.strictEqual(source.slice(impt.s, impt.e), impt.n);
+      for (const expt of exports)
+        assert.strictEqual(source.slice(expt.s, expt.e), expt.n);
+      assert.strictEqual(imports.length + exports.length, 2);
+    }
+  });
 });
 
 suite('Invalid syntax', () => {
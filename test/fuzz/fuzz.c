@@ -0,0 +1,273 @@
+/*
+ * Differential fuzz target for the lexer
+ *
+ *   clang -fsanitize=fuzzer test/fuzz/fuzz.c   (libFuzzer, or AFL++ with afl-clang-fast)
+ *   cc -DFUZZ_STANDALONE test/fuzz/fuzz.c      (replays the input files given)
+ *
+ * Every input is decoded as UTF-8 and lexed with the default path, copying
+ * the source in as UTF-16 and reading the records one at a time. The other
+ * paths the Wasm wrapper takes must then agree with it on the import and
+ * export records, facade and hasModuleSyntax:
+ *
+ * - the leading ASCII transferred as one byte per character and widened by sw
+ * - the columns written by wc, as read by parseRaw
+ * - detectModuleSyntax through md
+ * - a second parse in the same memory after lexing another source
+ * - ph with the source as the module script of an HTML document, with the
+ *   offsets shifted back by the tag before it
+ * - with -DLEXER_THREADS -pthread, pp in 2, 3 and 7 chunks
+ *
+ * pt lexes TypeScript differently, so it is only run for the sanitizers.
+ *
+ * Any divergence is printed and aborts, which the fuzzer reports as a crash.
+ * lexer.js is compared against the native driver by test/fuzz/replay.js.
+ */
+
+#include "../../bench/native.h"
+
+// ok, error, facade, hasModuleSyntax, import and export counts, then the
+// records as imports [s, e, ss, se, d, a, t, ip] and exports [s, e, ls, le]
+#define HEADER 6
+
+typedef struct {
+  int32_t* values;
+  size_t len;
+} Result;
+
+static void push (Result* result, int32_t value) {
+  result->values[result->len++] = value;
+}
+
+// reads the results of the last parse one record at a time, as parse does
+static void readResult (bool ok, Result* result) {
+  result->len = 0;
+  push(result, ok);
+  push(result, ok ? 0 : e());
+  push(result, f());
+  push(result, ms());
+  size_t counts = result->len;
+  push(result, 0);
+  push(result, 0);
+  if (!ok)
+    return;
+  while (ri()) {
+    push(result, is());
+    push(result, ie());
+    push(result, ss());
+    push(result, se());
+    push(result, id());
+    push(result, ai());
+    push(result, it());
+    push(result, ip());
+    result->values[counts]++;
+  }
+  while (re()) {
+    push(result, es());
+    push(result, ee());
+    push(result, els());
+    push(result, ele());
+    result->values[counts + 1]++;
+  }
+}
+
+// reads the results of the last parse from the columns of wc, as parseRaw does
+static void readColumns (bool ok, Result* result) {
+  result->len = 0;
+  push(result, ok);
+  push(result, ok ? 0 : e());
+  push(result, f());
+  push(result, ms());
+  if (!ok) {
+    push(result, 0);
+    push(result, 0);
+    return;
+  }
+  int32_t* columns = wc();
+  int32_t importCount = columns[0], exportCount = columns[1];
+  push(result, importCount);
+  push(result, exportCount);
+  for (int32_t i = 0; i < importCount; i++) {
+    for (int32_t field = 0; field < 8; field++)
+      push(result, columns[2 + importCount * field + i]);
+  }
+  int32_t* exportColumns = columns + 2 + importCount * 8;
+  for (int32_t i = 0; i < exportCount; i++) {
+    for (int32_t field = 0; field < 4; field++)
+      push(result, exportColumns[exportCount * field + i]);
+  }
+}
+
+static void diverged (const char* variant, const char* detail, const char16_t* input, size_t len) {
+  fprintf(stderr, "%s diverges from the default path: %s\nsource (%zu code units): ", variant, detail, len);
+  for (size_t i = 0; i < len; i++)
+    fputc(input[i] < 0x80 ? input[i] : '?', stderr);
+  fputc('\n', stderr);
+  abort();
+}
+
+static void compare (const char* variant, Result* result, Result* reference, const char16_t* input, size_t len) {
+  static const char* header[HEADER] = { "ok", "error", "facade", "hasModuleSyntax", "import count", "export count" };
+  char detail[128];
+  for (size_t i = 0; i < result->len && i < reference->len; i++) {
+    if (result->values[i] == reference->values[i])
+      continue;
+    if (i < HEADER)
+      snprintf(detail, sizeof(detail), "%s %d vs %d", header[i], result->values[i], reference->values[i]);
+    else
+      snprintf(detail, sizeof(detail), "record value %zu: %d vs %d", i - HEADER, result->values[i], reference->values[i]);
+    diverged(variant, detail, input, len);
+  }
+  if (result->len != reference->len) {
+    snprintf(detail, sizeof(detail), "%zu values vs %zu", result->len, reference->len);
+    diverged(variant, detail, input, len);
+  }
+}
+
+// the start tag wrapping the input for ph, which the input must not end early
+static const char16_t scriptTag[] = u"<script type=module>";
+static const char16_t scriptEndTag[] = u"</script>";
+#define SCRIPT_TAG_LEN (sizeof(scriptTag) / 2 - 1)
+#define SCRIPT_END_TAG_LEN (sizeof(scriptEndTag) / 2 - 1)
+
+// offsets of the records of ph, less the start tag, leaving -1 and -2 as they are
+static void unwrapHtmlResult (Result* result) {
+  int32_t* values = result->values;
+  if (!values[0])
+    values[1] -= SCRIPT_TAG_LEN;
+  size_t i = HEADER;
+  for (int32_t n = 0; n < values[4]; n++, i += 8) {
+    // s, e, ss, se, d and a
+    for (size_t field = 0; field < 6; field++) {
+      if (values[i + field] >= 0)
+        values[i + field] -= SCRIPT_TAG_LEN;
+    }
+  }
+  for (int32_t n = 0; n < values[5]; n++, i += 4) {
+    for (size_t field = 0; field < 4; field++) {
+      if (values[i + field] >= 0)
+        values[i + field] -= SCRIPT_TAG_LEN;
+    }
+  }
+}
+
+// lexed between two parses of the input, see LLVMFuzzerTestOneInput
+static const char16_t other[] = u"import a from 'a';\nexport { b as c };\nimport('d').then(`${e}`);\n";
+#define OTHER_LEN (sizeof(other) / 2 - 1)
+
+static void copyIn (char16_t* memory, const char16_t* input, size_t len) {
+  setSource(memory);
+  sa(len);
+  memcpy(memory, input, len * 2);
+}
+
+int LLVMFuzzerTestOneInput (const uint8_t* data, size_t size) {
+  char16_t* input = malloc((size + 1) * 2);
+  size_t len = decodeUtf8(data, size, input);
+  // source followed by the analysis arena, which is bounded by the source length
+  size_t memoryLen = len > OTHER_LEN ? len : OTHER_LEN;
+  char16_t* memory = calloc((memoryLen + 1) + (memoryLen + 1) * 32, 2);
+  // every record is at most 8 values, and takes at least one code unit
+  Result reference = { malloc((HEADER + (len + 1) * 8) * sizeof(int32_t)), 0 };
+  Result result = { malloc((HEADER + (len + 1) * 8) * sizeof(int32_t)), 0 };
+
+  copyIn(memory, input, len);
+  bool ok = parse();
+  readResult(ok, &reference);
+  bool hasModuleSyntax = ms();
+
+  // one-byte transfer of the leading ASCII, with the rest copied as UTF-16
+  size_t oneByteLen = 0;
+  while (oneByteLen < len && input[oneByteLen] < 0x80)
+    oneByteLen++;
+  setSource(memory);
+  sa(len);
+  for (size_t i = 0; i < oneByteLen; i++)
+    ((uint8_t*)memory)[len + i] = input[i];
+  sw(oneByteLen);
+  memcpy(memory + oneByteLen, input + oneByteLen, (len - oneByteLen) * 2);
+  readResult(parse(), &result);
+  compare("one-byte transfer", &result, &reference, input, len);
+
+  copyIn(memory, input, len);
+  readColumns(parse(), &result);
+  compare("columns", &result, &reference, input, len);
+
+  // detection stops at the first module syntax, so only a full parse
+  // without any must match the records
+  copyIn(memory, input, len);
+  bool detected = md();
+  if (ok && (!detected || ms() != hasModuleSyntax))
+    diverged("detectModuleSyntax", ms() ? "module syntax detected" : "no module syntax detected", input, len);
+  if (detected && !ms() && (!ok || hasModuleSyntax))
+    diverged("detectModuleSyntax", "lexed without module syntax", input, len);
+
+  // nothing of the previous parse may leak into the next one
+  copyIn(memory, other, OTHER_LEN);
+  parse();
+  copyIn(memory, input, len);
+  readResult(parse(), &result);
+  compare("second parse", &result, &reference, input, len);
+
+  // the HTML front end, unless the input holds anything like a script end tag
+  // or the HTML comments that change how it is found
+  bool endsScript = false;
+  for (size_t i = 0; i + 1 < len && !endsScript; i++)
+    endsScript = input[i] == '<' && (input[i + 1] == '/' || input[i + 1] == '!');
+  if (!endsScript) {
+    size_t htmlLen = SCRIPT_TAG_LEN + len + SCRIPT_END_TAG_LEN;
+    char16_t* html = calloc((htmlLen + 1) + (htmlLen + 1) * 32, 2);
+    setSource(html);
+    sa(htmlLen);
+    memcpy(html, scriptTag, SCRIPT_TAG_LEN * 2);
+    memcpy(html + SCRIPT_TAG_LEN, input, len * 2);
+    memcpy(html + SCRIPT_TAG_LEN + len, scriptEndTag, SCRIPT_END_TAG_LEN * 2);
+    readResult(ph(), &result);
+    unwrapHtmlResult(&result);
+    compare("HTML module script", &result, &reference, input, len);
+    free(html);
+  }
+
+  copyIn(memory, input, len);
+  readResult(pt(), &result);
+
+#ifdef LEXER_THREADS
+  // chunks are lexed from their own start and stitched, which the budget of
+  // parse does not apply to
+  if (!budgetExceeded) {
+    static const uint32_t chunkCounts[] = { 2, 3, 7 };
+    for (size_t i = 0; i < sizeof(chunkCounts) / sizeof(chunkCounts[0]); i++) {
+      copyIn(memory, input, len);
+      readResult(pp(chunkCounts[i]), &result);
+      compare("parallel parse", &result, &reference, input, len);
+    }
+  }
+#endif
+
+  free(result.values);
+  free(reference.values);
+  free(memory);
+  free(input);
+  return 0;
+}
+
+#ifdef FUZZ_STANDALONE
+int main (int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    FILE* fp = fopen(argv[i], "rb");
+    if (fp == NULL) {
+      fprintf(stderr, "Unable to read %s\n", argv[i]);
+      return 1;
+    }
+    fseek(fp, 0, SEEK_END);
+    size_t size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t* data = malloc(size);
+    size = fread(data, 1, size, fp);
+    fclose(fp);
+    LLVMFuzzerTestOneInput(data, size);
+    free(data);
+  }
+  printf("%d inputs agree\n", argc - 1);
+  return 0;
+}
+#endif
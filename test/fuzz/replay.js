@@ -0,0 +1,57 @@
+/*
+ * Compares lexer.js against the C lexer on fuzz inputs
+ *
+ *   node test/fuzz/replay.js dir...
+ *
+ * The native target can only run the C lexer, so the inputs it found, or any
+ * other directory of sources, are replayed through lexer.js and the native
+ * driver (lib/pgo/lexer-native). Inputs that are not valid UTF-8 are skipped,
+ * since the two decode those differently.
+ */
+
+import fs from 'fs';
+import path from 'path';
+import { execFileSync } from 'child_process';
+import { fileURLToPath } from 'url';
+import { fromSpecifiers, difference } from '../../bench/results.js';
+import { parse } from '../../lexer.js';
+
+const nativeBin = fileURLToPath(new URL('../../lib/pgo/lexer-native', import.meta.url));
+// files per native driver process
+const BATCH = 500;
+// differences printed in full
+const SHOW = 20;
+
+const files = process.argv.slice(2).flatMap(dir => fs.readdirSync(dir).map(f => path.join(dir, f)))
+	.filter(file => fs.statSync(file).isFile())
+	.filter(file => {
+		const bytes = fs.readFileSync(file);
+		return Buffer.from(bytes.toString()).equals(bytes);
+	});
+
+const differences = [];
+for (let i = 0; i < files.length; i += BATCH) {
+	const batch = files.slice(i, i + BATCH);
+	const results = execFileSync(nativeBin, ['-d', ...batch], { maxBuffer: 1 << 28 }).toString().trim().split('\n')
+		.map(line => JSON.parse(line));
+	batch.forEach((file, j) => {
+		let result;
+		try {
+			result = fromSpecifiers(parse(fs.readFileSync(file, 'utf8')));
+		}
+		catch (err) {
+			result = { error: err.idx ?? -1 };
+		}
+		const diff = difference(result, results[j]);
+		if (diff)
+			differences.push(`${file}: ${diff}`);
+	});
+}
+
+for (const diff of differences.slice(0, SHOW))
+	console.log(diff);
+if (differences.length > SHOW)
+	console.log(`... and ${differences.length - SHOW} more`);
+console.log(`${files.length - differences.length} of ${files.length} inputs agree between lexer.js and the C lexer`);
+if (differences.length)
+	process.exitCode = 1;
@@ -0,0 +1,38 @@
+/*
+ * Seed corpus for the fuzz target
+ *
+ *   node test/fuzz/seed.js [outDir]
+ *
+ * Writes the test/samples files along with every source literal passed to the
+ * lexer in test/_unit.cjs, one file each, to lib/fuzz/seed by default.
+ */
+
+import fs from 'fs';
+import path from 'path';
+
+const outDir = process.argv[2] || 'lib/fuzz/seed';
+
+fs.rmSync(outDir, { recursive: true, force: true });
+fs.mkdirSync(outDir, { recursive: true });
+
+for (const file of fs.readdirSync('test/samples'))
+	fs.copyFileSync(`test/samples/${file}`, path.join(outDir, file));
+
+// string and template literals passed to parse, parseRaw and
+// detectModuleSyntax or assigned to a source variable, skipping templates
+// whose substitutions refer to the test scope
+const unit = fs.readFileSync('test/_unit.cjs', 'utf8');
+const literal = /(?:parse|parseRaw|detectModuleSyntax|source\s*=)\s*\(?\s*(`(?:[^`\\]|\\.)*`|'(?:[^'\\\n]|\\.)*'|"(?:[^"\\\n]|\\.)*")/g;
+const sources = new Set();
+for (const [, match] of unit.matchAll(literal)) {
+	try {
+		sources.add((0, eval)(match));
+	}
+	catch {}
+}
+
+let i = 0;
+for (const source of sources)
+	fs.writeFileSync(path.join(outDir, `unit-${String(i++).padStart(3, '0')}.js`), source);
+
+console.log(`Wrote ${fs.readdirSync('test/samples').length} samples and ${sources.size} unit test sources to ${outDir}`);
@@ -4,7 +4,7 @@ let parse;
 const init = (async () => {
   if (parse) return;
   if (process.env.WASM) {
-    const m = await import('../dist/lexer.js');
+    const m = await import(process.env.WASM === 'fast' || process.env.WASM === 'asset' || process.env.WASM === 'stats' ? `../dist/lexer.${process.env.WASM}.js` : '../dist/lexer.js');
     await m.init;
     parse = m.parse;
   }